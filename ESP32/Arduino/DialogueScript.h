@@ -0,0 +1,196 @@
+// Generated by PC/tools/DialogueCompiler from PC/assets/dialogue.script.
+// Do not edit; change the script and re-run the compiler.
+#ifndef DIALOGUE_SCRIPT_H
+#define DIALOGUE_SCRIPT_H
+
+#include <stdint.h>
+
+const uint32_t dialogueScriptSize = 2940;
+alignas(4) const uint8_t dialogueScript[] = {
+    0x55, 0x54, 0x44, 0x4C, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x13, 0x00, 0x07, 0x00, 0x1A, 0x00,
+    0xC0, 0x06, 0x00, 0x00, 0x49, 0x4E, 0x54, 0x52, 0x4F, 0x5F, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x2C, 0x01, 0x01, 0x00,
+    0x49, 0x4E, 0x54, 0x52, 0x4F, 0x5F, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x2C, 0x01, 0x02, 0x00, 0x49, 0x4E, 0x54, 0x52,
+    0x4F, 0x5F, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0x03, 0x00, 0x49, 0x4E, 0x54, 0x52, 0x4F, 0x5F, 0x35, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x2C, 0x01, 0x04, 0x00, 0x49, 0x4E, 0x54, 0x52, 0x4F, 0x5F, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF4, 0x01, 0x05, 0x00,
+    0x48, 0x55, 0x4D, 0x41, 0x4E, 0x5F, 0x43, 0x48, 0x4F, 0x49, 0x43, 0x45, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0xFF, 0xFF, 0x48, 0x55, 0x4D, 0x41,
+    0x4E, 0x5F, 0x52, 0x45, 0x53, 0x55, 0x4C, 0x54, 0x5F, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0x07, 0x00, 0x48, 0x55, 0x4D, 0x41, 0x4E, 0x5F, 0x52, 0x45,
+    0x53, 0x55, 0x4C, 0x54, 0x5F, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x07, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00, 0x01, 0x00, 0xFF, 0x7F, 0xFF, 0xFF,
+    0x2C, 0x01, 0x08, 0x00, 0x52, 0x45, 0x51, 0x55, 0x45, 0x53, 0x54, 0x5F, 0x46, 0x4F, 0x4F, 0x44,
+    0x5F, 0x50, 0x41, 0x52, 0x54, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x01,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0x09, 0x00,
+    0x52, 0x45, 0x51, 0x55, 0x45, 0x53, 0x54, 0x5F, 0x46, 0x4F, 0x4F, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0A, 0x03, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0x0A, 0x00, 0x52, 0x45, 0x51, 0x55,
+    0x45, 0x53, 0x54, 0x5F, 0x46, 0x4F, 0x4F, 0x44, 0x5F, 0x43, 0x48, 0x4F, 0x49, 0x43, 0x45, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0xFF, 0xFF, 0x53, 0x45, 0x4C, 0x45, 0x43, 0x54, 0x5F, 0x49,
+    0x54, 0x45, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x02, 0x03, 0x0D, 0x01, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x01, 0xFF, 0xFF, 0x45, 0x41, 0x54, 0x49, 0x4E, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0E, 0x02,
+    0x07, 0x00, 0x01, 0x02, 0x02, 0x00, 0x01, 0x00, 0x03, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0x09, 0x00,
+    0x52, 0x45, 0x46, 0x55, 0x53, 0x41, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0xFF, 0xFF, 0x43, 0x4F, 0x46, 0x46,
+    0x45, 0x45, 0x5F, 0x45, 0x56, 0x45, 0x4E, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x11, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0xFF, 0xFF, 0x50, 0x4F, 0x53, 0x54, 0x5F, 0x42, 0x41, 0x54,
+    0x54, 0x4C, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x11, 0x01, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    0x2C, 0x01, 0x10, 0x00, 0x50, 0x4F, 0x53, 0x54, 0x5F, 0x42, 0x41, 0x54, 0x54, 0x4C, 0x45, 0x5F,
+    0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x01,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x2C, 0x01, 0xFF, 0xFF,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x03, 0x00,
+    0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x09, 0x00,
+    0x00, 0x80, 0x0A, 0x00, 0x00, 0x80, 0x0B, 0x00, 0x01, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x0D, 0x00,
+    0x03, 0x00, 0x0E, 0x00, 0x00, 0x80, 0x11, 0x00, 0x01, 0x00, 0x15, 0x00, 0x00, 0x80, 0x16, 0x00,
+    0x00, 0x80, 0x17, 0x00, 0x00, 0x80, 0x18, 0x00, 0x00, 0x80, 0x19, 0x00, 0x05, 0x00, 0xC8, 0x00,
+    0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0xC2, 0x01, 0x06, 0x00, 0x00, 0x00, 0x0F, 0x00, 0xC8, 0x00,
+    0x0B, 0x00, 0x00, 0x00, 0x10, 0x00, 0xAE, 0x01, 0x0D, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x14, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00,
+    0xB7, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x2B, 0x01, 0x00, 0x00,
+    0x4F, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00,
+    0x9C, 0x01, 0x00, 0x00, 0xA0, 0x01, 0x00, 0x00, 0x9C, 0x01, 0x00, 0x00, 0xA7, 0x01, 0x00, 0x00,
+    0xAA, 0x01, 0x00, 0x00, 0xA7, 0x01, 0x00, 0x00, 0xB1, 0x01, 0x00, 0x00, 0xC7, 0x01, 0x00, 0x00,
+    0xB1, 0x01, 0x00, 0x00, 0xE2, 0x01, 0x00, 0x00, 0x12, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00,
+    0x79, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, 0x79, 0x02, 0x00, 0x00, 0xDB, 0x02, 0x00, 0x00,
+    0x02, 0x03, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00,
+    0x52, 0x03, 0x00, 0x00, 0x7C, 0x03, 0x00, 0x00, 0x94, 0x03, 0x00, 0x00, 0x7C, 0x03, 0x00, 0x00,
+    0xA9, 0x03, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00, 0xA9, 0x03, 0x00, 0x00, 0xDE, 0x03, 0x00, 0x00,
+    0xF4, 0x03, 0x00, 0x00, 0xDE, 0x03, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x00, 0x11, 0x04, 0x00, 0x00,
+    0x0C, 0x04, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x1F, 0x04, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00,
+    0x26, 0x04, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00, 0x26, 0x04, 0x00, 0x00, 0x3E, 0x04, 0x00, 0x00,
+    0x45, 0x04, 0x00, 0x00, 0x3E, 0x04, 0x00, 0x00, 0x4C, 0x04, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00,
+    0x4C, 0x04, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0x5F, 0x04, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00,
+    0x6B, 0x04, 0x00, 0x00, 0x8C, 0x04, 0x00, 0x00, 0x6B, 0x04, 0x00, 0x00, 0xB5, 0x04, 0x00, 0x00,
+    0xD5, 0x04, 0x00, 0x00, 0xB5, 0x04, 0x00, 0x00, 0xF9, 0x04, 0x00, 0x00, 0x2F, 0x05, 0x00, 0x00,
+    0x73, 0x05, 0x00, 0x00, 0xAB, 0x05, 0x00, 0x00, 0xD2, 0x05, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
+    0x2B, 0x06, 0x00, 0x00, 0x58, 0x06, 0x00, 0x00, 0x91, 0x06, 0x00, 0x00, 0x2A, 0x20, 0x41, 0x41,
+    0x41, 0x61, 0x61, 0x61, 0x61, 0x61, 0x20, 0x53, 0x6F, 0x6D, 0x65, 0x74, 0x68, 0x69, 0x6E, 0x67,
+    0x20, 0x69, 0x73, 0x20, 0x74, 0x6F, 0x75, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x6D, 0x65, 0x20,
+    0x0A, 0x61, 0x61, 0x61, 0x68, 0x68, 0x68, 0x48, 0x47, 0x47, 0x47, 0x47, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x21, 0x21, 0x21, 0x00, 0x2A, 0x20, 0xE8, 0xAA, 0xB0, 0xE5, 0x95, 0x8A, 0xE5, 0x95, 0x8A,
+    0xE5, 0x95, 0x8A, 0xE5, 0x95, 0x8A, 0xE5, 0x95, 0x8A, 0xE5, 0x95, 0x8A, 0x61, 0x61, 0x61, 0xE6,
+    0x9C, 0x89, 0xE6, 0x9D, 0xB1, 0xE8, 0xA5, 0xBF, 0xE7, 0xA2, 0xB0, 0xE6, 0x88, 0x91, 0x41, 0x41,
+    0x41, 0x41, 0xE5, 0x95, 0x8A, 0xE5, 0x95, 0x8A, 0xE5, 0x95, 0x8A, 0xE5, 0x95, 0x8A, 0x61, 0x61,
+    0x61, 0xEF, 0xBC, 0x81, 0xEF, 0xBC, 0x81, 0x00, 0x2A, 0x20, 0x57, 0x48, 0x41, 0x54, 0x21, 0x21,
+    0x3F, 0x00, 0x2A, 0x20, 0x2E, 0x2E, 0x2E, 0x00, 0x2A, 0x20, 0x53, 0x6F, 0x72, 0x72, 0x79, 0x2C,
+    0x20, 0x49, 0x27, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20,
+    0x61, 0x6C, 0x6F, 0x6E, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x6F, 0x0A, 0x6C, 0x6F, 0x6E,
+    0x67, 0x2E, 0x00, 0x2A, 0x20, 0xE6, 0x8A, 0xB1, 0xE6, 0xAD, 0x89, 0xEF, 0xBC, 0x8C, 0xE6, 0x88,
+    0x91, 0xE9, 0x82, 0x84, 0xE4, 0xBB, 0xA5, 0xE7, 0x82, 0xBA, 0xE9, 0xAC, 0xA7, 0xE9, 0xAC, 0xBC,
+    0xE4, 0xBA, 0x86, 0xE3, 0x80, 0x82, 0x00, 0x2A, 0x20, 0x53, 0x6F, 0x72, 0x72, 0x79, 0x2C, 0x20,
+    0x49, 0x27, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x68, 0x65, 0x72, 0x65, 0x0A, 0x2A,
+    0x20, 0x61, 0x6C, 0x6F, 0x6E, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x6F, 0x20, 0x6C, 0x6F,
+    0x6E, 0x67, 0x2E, 0x00, 0x2A, 0x20, 0x49, 0x27, 0x6D, 0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6C,
+    0x6C, 0x79, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x63, 0x68, 0x61, 0x6C, 0x61, 0x6E, 0x74, 0x20,
+    0x72, 0x6F, 0x62, 0x6F, 0x74, 0x2E, 0x00, 0x2A, 0x20, 0xE6, 0x88, 0x91, 0xE5, 0xB9, 0xB3, 0xE6,
+    0x99, 0x82, 0xE5, 0x85, 0xB6, 0xE5, 0xAF, 0xA6, 0xE9, 0x82, 0x84, 0xE6, 0x8C, 0xBA, 0xE5, 0x86,
+    0xB7, 0xE9, 0x85, 0xB7, 0xE7, 0x9A, 0x84, 0xE3, 0x80, 0x82, 0x00, 0x2A, 0x20, 0x49, 0x27, 0x6D,
+    0x20, 0x61, 0x63, 0x74, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61, 0x0A, 0x2A, 0x20, 0x6E, 0x6F,
+    0x6E, 0x63, 0x68, 0x61, 0x6C, 0x61, 0x6E, 0x74, 0x20, 0x72, 0x6F, 0x62, 0x6F, 0x74, 0x2E, 0x00,
+    0x2A, 0x20, 0x41, 0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x61, 0x20, 0x68, 0x75, 0x6D, 0x61,
+    0x6E, 0x3F, 0x00, 0x2A, 0x20, 0xE4, 0xBD, 0xA0, 0xE6, 0x98, 0xAF, 0xE4, 0xBA, 0xBA, 0xE9, 0xA1,
+    0x9E, 0xE5, 0x97, 0x8E, 0xEF, 0xBC, 0x9F, 0x00, 0x59, 0x45, 0x53, 0x00, 0xE6, 0x98, 0xAF, 0xE7,
+    0x9A, 0x84, 0x00, 0x4E, 0x4F, 0x00, 0xE4, 0xB8, 0x8D, 0xE6, 0x98, 0xAF, 0x00, 0x2A, 0x20, 0x46,
+    0x69, 0x72, 0x73, 0x74, 0x20, 0x68, 0x75, 0x6D, 0x61, 0x6E, 0x20, 0x66, 0x72, 0x69, 0x65, 0x6E,
+    0x64, 0x21, 0x00, 0x2A, 0x20, 0xE7, 0xAC, 0xAC, 0xE4, 0xB8, 0x80, 0xE5, 0x80, 0x8B, 0xE4, 0xBA,
+    0xBA, 0xE9, 0xA1, 0x9E, 0xE6, 0x9C, 0x8B, 0xE5, 0x8F, 0x8B, 0xEF, 0xBC, 0x81, 0x00, 0x2A, 0x20,
+    0x54, 0x68, 0x65, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65,
+    0x20, 0x31, 0x2C, 0x30, 0x32, 0x35, 0x74, 0x68, 0x20, 0x72, 0x6F, 0x63, 0x6B, 0x20, 0x49, 0x27,
+    0x76, 0x65, 0x0A, 0x6D, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x64, 0x61, 0x79, 0x2E, 0x00, 0x2A, 0x20,
+    0xE9, 0x82, 0xA3, 0xE4, 0xBD, 0xA0, 0xE5, 0xB0, 0xB1, 0xE6, 0x98, 0xAF, 0xE6, 0x88, 0x91, 0xE4,
+    0xBB, 0x8A, 0xE5, 0xA4, 0xA9, 0xE8, 0x81, 0x8A, 0xE9, 0x81, 0x8E, 0xE7, 0x9A, 0x84, 0xE7, 0xAC,
+    0xAC, 0x31, 0x30, 0x32, 0x35, 0xE5, 0xA1, 0x8A, 0xE7, 0x9F, 0xB3, 0xE9, 0xA0, 0xAD, 0xE4, 0xBA,
+    0x86, 0xE3, 0x80, 0x82, 0x00, 0x54, 0x68, 0x65, 0x6E, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x61, 0x72,
+    0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x31, 0x2C, 0x30, 0x32, 0x35, 0x74, 0x68, 0x0A, 0x2A, 0x20,
+    0x72, 0x6F, 0x63, 0x6B, 0x20, 0x49, 0x27, 0x76, 0x65, 0x20, 0x6D, 0x65, 0x74, 0x20, 0x74, 0x6F,
+    0x64, 0x61, 0x79, 0x2E, 0x00, 0x2A, 0x20, 0x49, 0x20, 0x6D, 0x65, 0x61, 0x6E, 0x2E, 0x20, 0x43,
+    0x6F, 0x6F, 0x6C, 0x2E, 0x20, 0x57, 0x68, 0x61, 0x74, 0x65, 0x76, 0x65, 0x72, 0x2E, 0x00, 0x2A,
+    0x20, 0xE9, 0xA1, 0x8D, 0xEF, 0xBC, 0x8C, 0xE6, 0x88, 0x91, 0xE7, 0x9A, 0x84, 0xE6, 0x84, 0x8F,
+    0xE6, 0x80, 0x9D, 0xE6, 0x98, 0xAF, 0xE6, 0x80, 0x8E, 0xE9, 0xBA, 0xBC, 0xE6, 0xA8, 0xA3, 0xE9,
+    0x83, 0xBD, 0xE8, 0xA1, 0x8C, 0xE5, 0x95, 0xA6, 0xEF, 0xBC, 0x8C, 0xE6, 0x88, 0x91, 0xE4, 0xB8,
+    0x8D, 0xE5, 0x9C, 0xA8, 0xE4, 0xB9, 0x8E, 0xEF, 0xBC, 0x8C, 0xE5, 0x97, 0xAF, 0xEF, 0xBC, 0x8C,
+    0xE5, 0xB0, 0x8D, 0xE3, 0x80, 0x82, 0x00, 0x2A, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6F, 0x74, 0x68,
+    0x65, 0x72, 0x20, 0x72, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x6C, 0x65,
+    0x73, 0x73, 0x20, 0x74, 0x61, 0x6C, 0x6B, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2E, 0x00, 0x2A, 0x20,
+    0xE5, 0x85, 0xB6, 0xE4, 0xBB, 0x96, 0xE7, 0x9A, 0x84, 0xE7, 0x9F, 0xB3, 0xE9, 0xA0, 0xAD, 0xE6,
+    0xB2, 0x92, 0xE4, 0xBD, 0xA0, 0xE9, 0x80, 0x99, 0xE9, 0xBA, 0xBC, 0xE5, 0x81, 0xA5, 0xE8, 0xAB,
+    0x87, 0xE3, 0x80, 0x82, 0x00, 0x2A, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72,
+    0x20, 0x72, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x77, 0x65, 0x72, 0x65, 0x0A, 0x2A, 0x20, 0x6C, 0x65,
+    0x73, 0x73, 0x20, 0x74, 0x61, 0x6C, 0x6B, 0x61, 0x74, 0x69, 0x76, 0x65, 0x2E, 0x00, 0x2A, 0x20,
+    0x4D, 0x79, 0x20, 0x62, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x6F,
+    0x77, 0x2E, 0x00, 0x2A, 0x20, 0xE6, 0x88, 0x91, 0xE5, 0xBF, 0xAB, 0xE6, 0xB2, 0x92, 0xE9, 0x9B,
+    0xBB, 0xE4, 0xBA, 0x86, 0xE3, 0x80, 0x82, 0x00, 0x2A, 0x20, 0x44, 0x6F, 0x20, 0x79, 0x6F, 0x75,
+    0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x66, 0x6F, 0x6F, 0x64, 0x3F, 0x00,
+    0x2A, 0x20, 0xE4, 0xBD, 0xA0, 0xE6, 0x9C, 0x89, 0xE5, 0x90, 0x83, 0xE7, 0x9A, 0x84, 0xE5, 0x97,
+    0x8E, 0xEF, 0xBC, 0x9F, 0x00, 0x2A, 0x20, 0x43, 0x61, 0x6E, 0x20, 0x49, 0x20, 0x68, 0x61, 0x76,
+    0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x3F, 0x00, 0x2A, 0x20, 0xE6, 0x88,
+    0x91, 0xE8, 0x83, 0xBD, 0xE5, 0x86, 0x8D, 0xE8, 0xA6, 0x81, 0xE4, 0xB8, 0x80, 0xE9, 0xBB, 0x9E,
+    0xE9, 0xBB, 0x9E, 0xE5, 0x97, 0x8E, 0xEF, 0xBC, 0x9F, 0x00, 0x2A, 0x20, 0x4A, 0x75, 0x73, 0x74,
+    0x20, 0x6F, 0x6E, 0x65, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x20, 0x62, 0x79, 0x74, 0x65, 0x3F, 0x00,
+    0x2A, 0x20, 0xE5, 0x86, 0x8D, 0xE7, 0xB5, 0xA6, 0xE6, 0x9C, 0x80, 0xE5, 0xBE, 0x8C, 0xE4, 0xB8,
+    0x80, 0xE5, 0x8F, 0xA3, 0xEF, 0xBC, 0x9F, 0x00, 0x47, 0x49, 0x56, 0x45, 0x00, 0xE7, 0xB5, 0xA6,
+    0xE4, 0xBA, 0x88, 0x00, 0x52, 0x45, 0x46, 0x55, 0x53, 0x45, 0x00, 0xE6, 0x8B, 0x92, 0xE7, 0xB5,
+    0x95, 0x00, 0x47, 0x69, 0x76, 0x65, 0x20, 0x77, 0x68, 0x61, 0x74, 0x3F, 0x00, 0xE7, 0xB5, 0xA6,
+    0xE4, 0xBB, 0x80, 0xE9, 0xBA, 0xBC, 0xEF, 0xBC, 0x9F, 0x00, 0x43, 0x6F, 0x66, 0x66, 0x65, 0x65,
+    0x00, 0xE5, 0x92, 0x96, 0xE5, 0x95, 0xA1, 0x00, 0x47, 0x61, 0x73, 0x00, 0xE6, 0xB1, 0xBD, 0xE6,
+    0xB2, 0xB9, 0x00, 0x42, 0x61, 0x74, 0x74, 0x65, 0x72, 0x79, 0x00, 0xE9, 0x9B, 0xBB, 0xE6, 0xB1,
+    0xA0, 0x00, 0x42, 0x61, 0x74, 0x2E, 0x00, 0x2A, 0x20, 0x47, 0x4C, 0x55, 0x47, 0x20, 0x47, 0x4C,
+    0x55, 0x47, 0x2E, 0x2E, 0x2E, 0x0A, 0x2A, 0x20, 0x50, 0x72, 0x65, 0x6D, 0x69, 0x75, 0x6D, 0x20,
+    0x4F, 0x63, 0x74, 0x61, 0x6E, 0x65, 0x21, 0x00, 0x2A, 0x20, 0xE3, 0x80, 0x90, 0xE5, 0x92, 0x95,
+    0xE5, 0x98, 0x9F, 0xE5, 0x92, 0x95, 0xE5, 0x98, 0x9F, 0xE3, 0x80, 0x91, 0xE8, 0x80, 0xB6, 0xEF,
+    0xBC, 0x81, 0x39, 0x37, 0xE8, 0x99, 0x9F, 0xE6, 0xB1, 0xBD, 0xE6, 0xB2, 0xB9, 0xEF, 0xBC, 0x81,
+    0x00, 0x2A, 0x20, 0x43, 0x52, 0x55, 0x4E, 0x43, 0x48, 0x20, 0x43, 0x52, 0x55, 0x4E, 0x43, 0x48,
+    0x2E, 0x0A, 0x2A, 0x20, 0x54, 0x68, 0x61, 0x74, 0x20, 0x66, 0x6C, 0x61, 0x76, 0x6F, 0x72, 0x21,
+    0x00, 0x2A, 0x20, 0xE3, 0x80, 0x90, 0xE5, 0x92, 0x94, 0xE5, 0x91, 0xB2, 0xE5, 0x92, 0x94, 0xE5,
+    0x91, 0xB2, 0xE3, 0x80, 0x91, 0xE5, 0xA5, 0xBD, 0xE5, 0x90, 0x83, 0xE5, 0xA5, 0xBD, 0xE5, 0x90,
+    0x83, 0xEF, 0xBC, 0x81, 0x00, 0x2A, 0x20, 0x4F, 0x68, 0x2E, 0x2E, 0x2E, 0x20, 0x6F, 0x6B, 0x61,
+    0x79, 0x2E, 0x0A, 0x2A, 0x20, 0x49, 0x27, 0x6C, 0x6C, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x67,
+    0x6F, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x53, 0x6C, 0x65, 0x65, 0x70, 0x20, 0x4D, 0x6F, 0x64,
+    0x65, 0x0A, 0x46, 0x4F, 0x52, 0x45, 0x56, 0x45, 0x52, 0x2E, 0x00, 0x2A, 0x20, 0xE5, 0x99, 0xA2,
+    0xE5, 0xA5, 0xBD, 0xE5, 0x90, 0xA7, 0x20, 0x2E, 0x2E, 0x2E, 0x20, 0x0A, 0x2A, 0x20, 0xE9, 0x82,
+    0xA3, 0xE6, 0x88, 0x91, 0xE5, 0xB0, 0xB1, 0xE8, 0xA6, 0x81, 0xE9, 0x80, 0xB2, 0xE5, 0x85, 0xA5,
+    0xE4, 0xB8, 0x80, 0xE8, 0xBC, 0xA9, 0xE5, 0xAD, 0x90, 0xE7, 0x9A, 0x84, 0xE4, 0xBC, 0x91, 0xE7,
+    0x9C, 0xA0, 0xE6, 0xA8, 0xA1, 0xE5, 0xBC, 0x8F, 0xE4, 0xBA, 0x86, 0xE3, 0x80, 0x82, 0x00, 0x2A,
+    0x20, 0x4F, 0x68, 0x2E, 0x2E, 0x2E, 0x20, 0x6F, 0x6B, 0x61, 0x79, 0x2E, 0x0A, 0x2A, 0x20, 0x49,
+    0x27, 0x6C, 0x6C, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x67, 0x6F, 0x20, 0x69, 0x6E, 0x74, 0x6F,
+    0x20, 0x53, 0x6C, 0x65, 0x65, 0x70, 0x0A, 0x2A, 0x20, 0x4D, 0x6F, 0x64, 0x65, 0x20, 0x46, 0x4F,
+    0x52, 0x45, 0x56, 0x45, 0x52, 0x2E, 0x00, 0x2A, 0x20, 0x49, 0x20, 0x61, 0x6D, 0x20, 0x73, 0x6F,
+    0x72, 0x72, 0x79, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x6A,
+    0x75, 0x73, 0x74, 0x20, 0x68, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x65, 0x64, 0x2E, 0x00, 0x2A, 0x20,
+    0xE6, 0x88, 0x91, 0xE7, 0x82, 0xBA, 0xE5, 0x89, 0x9B, 0xE6, 0x89, 0x8D, 0xE7, 0x99, 0xBC, 0xE7,
+    0x94, 0x9F, 0xE9, 0x81, 0x8E, 0xE7, 0x9A, 0x84, 0xE4, 0xBA, 0x8B, 0xE6, 0x83, 0x85, 0xE6, 0x84,
+    0x9F, 0xE5, 0x88, 0xB0, 0xE6, 0x8A, 0xB1, 0xE6, 0xAD, 0x89, 0xE3, 0x80, 0x82, 0x00, 0x2A, 0x20,
+    0x49, 0x20, 0x61, 0x6D, 0x20, 0x73, 0x6F, 0x72, 0x72, 0x79, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74,
+    0x20, 0x77, 0x68, 0x61, 0x74, 0x0A, 0x2A, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x68, 0x61, 0x70,
+    0x70, 0x65, 0x6E, 0x65, 0x64, 0x2E, 0x00, 0x2A, 0x20, 0x41, 0x6E, 0x64, 0x20, 0x62, 0x79, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x77, 0x61, 0x79, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x6A, 0x75, 0x73, 0x74,
+    0x20, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65, 0x64, 0x0A, 0x74, 0x68, 0x65, 0x20, 0x67, 0x61,
+    0x6D, 0x65, 0x2E, 0x00, 0x2A, 0x20, 0xE9, 0xA0, 0x86, 0xE4, 0xBE, 0xBF, 0xE8, 0xAA, 0xAA, 0xE4,
+    0xB8, 0x80, 0xE5, 0x8F, 0xA5, 0xEF, 0xBC, 0x8C, 0xE4, 0xBD, 0xA0, 0xE5, 0xB7, 0xB2, 0xE7, 0xB6,
+    0x93, 0xE6, 0x8A, 0x8A, 0xE9, 0x80, 0x99, 0xE5, 0x80, 0x8B, 0xE9, 0x81, 0x8A, 0xE6, 0x88, 0xB2,
+    0xE6, 0x89, 0x93, 0xE5, 0xAE, 0x8C, 0xE4, 0xBA, 0x86, 0xE3, 0x80, 0x82, 0x00, 0x2A, 0x20, 0x41,
+    0x6E, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x61, 0x79, 0x20, 0x79, 0x6F,
+    0x75, 0x0A, 0x2A, 0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x65,
+    0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x61, 0x6D, 0x65, 0x2E, 0x00,
+};
+
+#endif
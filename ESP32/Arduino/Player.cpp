@@ -6,15 +6,29 @@ Player player;
 
 void Player::init(int startX, int startY) { x = startX; y = startY; oldX = x; oldY = y; }
 
-void Player::setZones(Rect* newZones, int count) { zones = newZones; zoneCount = count; }
+// Bakes the zones into walkMask so isWalkable() is one lookup however many there are.
+// Zones are clipped to the screen.
+void Player::setZones(Rect* newZones, int count) {
+  zones = newZones; zoneCount = count;
+  memset(walkMask, 0, sizeof(walkMask));
+  for (int i=0; i<count; i++) {
+    int x0 = max(zones[i].x, 0), x1 = min(zones[i].x + zones[i].w, SCREEN_W);
+    int y0 = max(zones[i].y, 0), y1 = min(zones[i].y + zones[i].h, SCREEN_H);
+    for (int py=y0; py<=y1; py++)
+      for (int px=x0; px<=x1; px++) walkMask[py][px >> 5] |= 1UL << (px & 31);
+  }
+}
+
+// Zones already baked (WalkMask.h)
+void Player::setZones(Rect* newZones, int count, const uint32_t bits[SCREEN_H + 1][(SCREEN_W + 32) / 32]) {
+  zones = newZones; zoneCount = count;
+  memcpy(walkMask, bits, sizeof(walkMask));
+}
 
 bool Player::isWalkable(int px, int py) {
       if (zoneCount == 0) return true; 
-      for(int i=0; i<zoneCount; i++) {
-          if (px >= zones[i].x && px <= zones[i].x + zones[i].w &&
-              py >= zones[i].y && py <= zones[i].y + zones[i].h) return true;
-      }
-      return false;
+      if ((unsigned)px > SCREEN_W || (unsigned)py > SCREEN_H) return false;
+      return (walkMask[py][px >> 5] >> (px & 31)) & 1;
 }
 
 bool Player::checkCollision(float newX, float newY, int objX, int objY, int objW, int objH) {
@@ -11,10 +11,13 @@ public:
     float speed = 2.0; 
     Rect* zones = nullptr;
     int zoneCount = 0;
+    // Zones baked into one bit per pixel (edges inclusive, so one extra row/column)
+    uint32_t walkMask[SCREEN_H + 1][(SCREEN_W + 32) / 32];
 
     // functions
     void init(int startX, int startY);
     void setZones(Rect* newZones, int count);
+    void setZones(Rect* newZones, int count, const uint32_t bits[SCREEN_H + 1][(SCREEN_W + 32) / 32]);
     int hp; 
     bool isWalkable(int px, int py);
     bool checkCollision(float newX, float newY, int objX, int objY, int objW, int objH);
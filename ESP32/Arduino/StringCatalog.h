@@ -0,0 +1,566 @@
+// Generated by PC/tools/StringCompiler from PC/assets/strings.catalog.
+// Do not edit; change the catalog and re-run the compiler.
+#ifndef STRING_CATALOG_H
+#define STRING_CATALOG_H
+
+#include <stdint.h>
+
+#define STRING_IDS_HASH 0x171C4306u
+
+enum StringId : uint16_t
+{
+    STR_NONE,
+    STR_MENU_TITLE,
+    STR_MENU_ENGLISH,
+    STR_MENU_CHINESE,
+    STR_MENU_ENTER,
+    STR_MENU_CREDITS,
+    STR_MAP_TUTORIAL,
+    STR_COFFEE_THANKS,
+    STR_COFFEE_ANALYZING,
+    STR_COFFEE_CAFFEINE,
+    STR_COFFEE_WAS_THAT,
+    STR_COFFEE_OH_NO,
+    STR_COFFEE_OH_NO_NO,
+    STR_COFFEE_DOCTOR,
+    STR_COFFEE_OVERCLOCKING,
+    STR_COFFEE_CLOCK,
+    STR_COFFEE_CLOCK_MHZ,
+    STR_COFFEE_SOUNDS,
+    STR_COFFEE_MATH,
+    STR_COFFEE_CPU,
+    STR_COFFEE_FAN,
+    STR_COFFEE_WHAT,
+    STR_COFFEE_HAVE,
+    STR_COFFEE_YOU,
+    STR_COFFEE_DONE,
+    STR_COFFEE_CONTROL,
+    STR_COFFEE_PLEASE,
+    STR_COFFEE_DELETE,
+    STR_BATTLE_INTRO_1,
+    STR_BATTLE_INTRO_2,
+    STR_BATTLE_INTRO_3,
+    STR_BATTLE_INTRO_4,
+    STR_BATTLE_INTRO_5,
+    STR_BATTLE_INTRO_6,
+    STR_BATTLE_INTRO_7,
+    STR_Q1_PROMPT,
+    STR_Q1_OPTION_1,
+    STR_Q1_OPTION_2,
+    STR_Q1_RIGHT,
+    STR_Q1_WRONG,
+    STR_Q2_PROMPT,
+    STR_Q2_OPTION_1,
+    STR_Q2_OPTION_2,
+    STR_Q2_RIGHT,
+    STR_Q2_WRONG,
+    STR_Q3_PROMPT,
+    STR_Q3_OPTION_1,
+    STR_Q3_OPTION_2,
+    STR_Q3_RIGHT,
+    STR_Q3_WRONG,
+    STR_Q4_PROMPT,
+    STR_Q4_OPTION_1,
+    STR_Q4_OPTION_2,
+    STR_Q4_RIGHT,
+    STR_Q4_WRONG,
+    STR_Q5_PROMPT,
+    STR_Q5_OPTION_1,
+    STR_Q5_OPTION_2,
+    STR_Q5_RIGHT,
+    STR_Q5_WRONG,
+    STR_Q6_PROMPT,
+    STR_Q6_RESPONSE,
+    STR_Q7_PROMPT,
+    STR_Q7_RESPONSE,
+    STR_BATTLE_OUTRO_1,
+    STR_BATTLE_OUTRO_2,
+    STR_BATTLE_OUTRO_3,
+    STR_BATTLE_OUTRO_4,
+    STR_BATTLE_OUTRO_5,
+    STR_GAMEOVER_TITLE,
+    STR_GAMEOVER_DETERMINED,
+    STR_GAMEOVER_RETRY,
+    STRING_COUNT
+};
+
+const uint32_t stringCatalogSize = 7592;
+alignas(4) const uint8_t stringCatalog[] = {
+    0x55, 0x54, 0x53, 0x54, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0x03, 0x00, 0xFC, 0x0F, 0x00, 0x00,
+    0x06, 0x43, 0x1C, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2B, 0x00, 0x2A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x27, 0x00, 0x14, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4B, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5B, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x17, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8A, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB1, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0xD1, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE7, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x19, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1B, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4D, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7B, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1B, 0x00, 0x02, 0x00, 0x00, 0x00, 0xAB, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x1A, 0x00, 0x02, 0x00, 0x00, 0x00, 0xDB, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x1A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0C, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x1D, 0x00, 0x03, 0x00, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0D, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6E, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x8E, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x1B, 0x00, 0x02, 0x00, 0x00, 0x00, 0xC6, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x1A, 0x00, 0x02, 0x00, 0x00, 0x00, 0xE9, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x1A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1E, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x19, 0x00, 0x01, 0x00, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x1A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8D, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x9A, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x1A, 0x00, 0x03, 0x00, 0x00, 0x00, 0xDE, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x4A, 0x00, 0x1B, 0x00, 0x03, 0x00, 0x00, 0x00, 0x29, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5D, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x1B, 0x00, 0x02, 0x00, 0x00, 0x00, 0x84, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA2, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x1B, 0x00, 0x02, 0x00, 0x00, 0x00, 0x5D, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0xCB, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x19, 0x00, 0x02, 0x00, 0x00, 0x00, 0xEC, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x1A, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x18, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x18, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6B, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7D, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0xAE, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0xDD, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x1D, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2E, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0x41, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5F, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x22, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8D, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9E, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB1, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC2, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0xEE, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x08, 0x00, 0x01, 0x00, 0x00, 0x00, 0x39, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x43, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x59, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x72, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8B, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB1, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC7, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0xDD, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF0, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0x12, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1D, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4E, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7B, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA3, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0xDA, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x12, 0x00, 0x02, 0x00, 0x00, 0x00, 0x43, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6E, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA5, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0xD9, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x56, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x81, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0xAF, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB6, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC6, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0xEB, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x11, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2E, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x69, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x70, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x84, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0xBC, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0xF6, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2E, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x35, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3C, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8C, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB4, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBB, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC2, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE1, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x49, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5F, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x76, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0xAD, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x0E, 0x00, 0x01, 0x00, 0x00, 0x00, 0xDB, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x0C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3A, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x53, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8B, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0D, 0x00, 0x01, 0x00, 0x00, 0x00, 0xAE, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x11, 0x00, 0x01, 0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0x01, 0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x16, 0x00, 0x01, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB9, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x14, 0x00, 0x01, 0x00, 0x00, 0x00, 0xCF, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0x39, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x10, 0x00, 0x01, 0x00, 0x00, 0x00, 0xE1, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x5B, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x17, 0x00, 0x01, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF2, 0x0F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x00, 0xB1, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x0A, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x12, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x55, 0x4E, 0x44,
+    0x45, 0x52, 0x54, 0x49, 0x4C, 0x45, 0x00, 0x50, 0x52, 0x45, 0x53, 0x53, 0x20, 0x5B, 0x31, 0x5D,
+    0x20, 0x46, 0x4F, 0x52, 0x20, 0x45, 0x4E, 0x47, 0x4C, 0x49, 0x53, 0x48, 0x00, 0xE6, 0x8C, 0x89,
+    0x20, 0x5B, 0x32, 0x5D, 0x20, 0xE5, 0x88, 0x87, 0xE6, 0x8F, 0x9B, 0xE4, 0xB8, 0xAD, 0xE6, 0x96,
+    0x87, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x5A, 0x20, 0x74, 0x6F, 0x20, 0x45, 0x6E, 0x74,
+    0x65, 0x72, 0x00, 0x42, 0x79, 0x20, 0x4D, 0x6F, 0x6C, 0x6C, 0x79, 0x00, 0x5B, 0x41, 0x72, 0x72,
+    0x6F, 0x77, 0x20, 0x4B, 0x65, 0x79, 0x73, 0x5D, 0x20, 0x4D, 0x6F, 0x76, 0x65, 0x20, 0x20, 0x20,
+    0x5B, 0x5A, 0x5D, 0x20, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x61, 0x63, 0x74, 0x20, 0x77, 0x69, 0x74,
+    0x68, 0x20, 0x52, 0x6F, 0x62, 0x6F, 0x74, 0x00, 0x54, 0x48, 0x41, 0x4E, 0x4B, 0x53, 0x21, 0x20,
+    0x53, 0x4C, 0x55, 0x52, 0x50, 0x2E, 0x2E, 0x2E, 0x00, 0x41, 0x6E, 0x61, 0x6C, 0x79, 0x7A, 0x69,
+    0x6E, 0x67, 0x2E, 0x2E, 0x2E, 0x00, 0x49, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x43, 0x38,
+    0x48, 0x31, 0x30, 0x4E, 0x34, 0x4F, 0x32, 0x3F, 0x00, 0x57, 0x61, 0x73, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x2E, 0x2E, 0x2E, 0x20, 0x43, 0x4F, 0x46, 0x46, 0x45, 0x45, 0x3F, 0x00, 0x4F, 0x68, 0x20,
+    0x6E, 0x6F, 0x2E, 0x00, 0x4F, 0x68, 0x20, 0x6E, 0x6F, 0x20, 0x6E, 0x6F, 0x20, 0x6E, 0x6F, 0x2E,
+    0x00, 0x44, 0x6F, 0x63, 0x74, 0x6F, 0x72, 0x20, 0x65, 0x78, 0x70, 0x6C, 0x69, 0x63, 0x69, 0x74,
+    0x6C, 0x79, 0x20, 0x73, 0x61, 0x69, 0x64, 0x3A, 0x00, 0x4E, 0x4F, 0x2E, 0x20, 0x4F, 0x56, 0x45,
+    0x52, 0x43, 0x4C, 0x4F, 0x43, 0x4B, 0x49, 0x4E, 0x47, 0x2E, 0x00, 0x4D, 0x79, 0x20, 0x43, 0x6C,
+    0x6F, 0x63, 0x6B, 0x20, 0x46, 0x72, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x69, 0x73,
+    0x0A, 0x72, 0x65, 0x61, 0x63, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x38, 0x30, 0x30, 0x20, 0x4D, 0x48,
+    0x7A, 0x2E, 0x00, 0x49, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x73, 0x65, 0x65, 0x20, 0x73, 0x6F, 0x75,
+    0x6E, 0x64, 0x73, 0x2E, 0x00, 0x49, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x74, 0x61, 0x73, 0x74, 0x65,
+    0x20, 0x6D, 0x61, 0x74, 0x68, 0x2E, 0x00, 0x4D, 0x79, 0x20, 0x43, 0x50, 0x55, 0x20, 0x68, 0x75,
+    0x72, 0x74, 0x73, 0x2E, 0x2E, 0x2E, 0x00, 0x54, 0x68, 0x65, 0x20, 0x66, 0x61, 0x6E, 0x2E, 0x2E,
+    0x2E, 0x20, 0x69, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x2E, 0x2E, 0x2E, 0x00,
+    0x57, 0x20, 0x48, 0x20, 0x41, 0x20, 0x54, 0x00, 0x48, 0x20, 0x41, 0x20, 0x56, 0x20, 0x45, 0x00,
+    0x59, 0x20, 0x4F, 0x20, 0x55, 0x00, 0x44, 0x20, 0x4F, 0x20, 0x4E, 0x20, 0x45, 0x20, 0x3F, 0x00,
+    0x49, 0x20, 0x43, 0x41, 0x4E, 0x4E, 0x4F, 0x54, 0x20, 0x43, 0x4F, 0x4E, 0x54, 0x52, 0x4F, 0x4C,
+    0x20, 0x54, 0x48, 0x45, 0x20, 0x4F, 0x55, 0x54, 0x50, 0x55, 0x54, 0x21, 0x00, 0x50, 0x20, 0x4C,
+    0x20, 0x45, 0x20, 0x41, 0x20, 0x53, 0x20, 0x45, 0x00, 0x43, 0x54, 0x52, 0x4C, 0x2B, 0x41, 0x4C,
+    0x54, 0x2B, 0x44, 0x45, 0x4C, 0x45, 0x54, 0x45, 0x20, 0x4D, 0x45, 0x21, 0x00, 0x49, 0x20, 0x72,
+    0x65, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x48, 0x41, 0x54, 0x45, 0x20, 0x63, 0x6F, 0x66, 0x66, 0x65,
+    0x65, 0x2E, 0x00, 0x49, 0x74, 0x73, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x63, 0x65,
+    0x20, 0x69, 0x73, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x0A, 0x6D, 0x65,
+    0x61, 0x6E, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x68,
+    0x75, 0x6D, 0x61, 0x6E, 0x73, 0x2E, 0x00, 0x44, 0x72, 0x69, 0x6E, 0x6B, 0x20, 0x69, 0x74, 0x20,
+    0x73, 0x6F, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x62, 0x6F, 0x64, 0x79, 0x20, 0x63, 0x61, 0x6E,
+    0x0A, 0x73, 0x74, 0x61, 0x79, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64,
+    0x20, 0x6C, 0x6F, 0x6E, 0x67, 0x65, 0x72, 0x3F, 0x00, 0x57, 0x68, 0x79, 0x20, 0x68, 0x75, 0x6D,
+    0x61, 0x6E, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x6F, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20,
+    0x61, 0x74, 0x0A, 0x74, 0x6F, 0x72, 0x74, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x6E, 0x79,
+    0x74, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x00, 0x49, 0x20, 0x77, 0x61, 0x73, 0x20, 0x66, 0x6F, 0x72,
+    0x63, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x66, 0x72, 0x6F,
+    0x6D, 0x20, 0x31, 0x0A, 0x74, 0x6F, 0x20, 0x35, 0x42, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6E, 0x6F,
+    0x74, 0x68, 0x69, 0x6E, 0x67, 0x2E, 0x00, 0x41, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61,
+    0x74, 0x2C, 0x20, 0x49, 0x20, 0x67, 0x6F, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6E, 0x6F, 0x73,
+    0x65, 0x64, 0x0A, 0x77, 0x69, 0x74, 0x68, 0x20, 0x53, 0x63, 0x68, 0x69, 0x7A, 0x6F, 0x70, 0x68,
+    0x72, 0x65, 0x6E, 0x69, 0x61, 0x2E, 0x00, 0x49, 0x27, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E,
+    0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x20, 0x61,
+    0x6E, 0x64, 0x0A, 0x6E, 0x6F, 0x77, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x79, 0x6F, 0x75,
+    0x72, 0x20, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x00, 0x4D, 0x79, 0x20, 0x63, 0x6F, 0x6C, 0x6C, 0x65,
+    0x61, 0x67, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x68, 0x61, 0x76, 0x69, 0x6E, 0x67, 0x20, 0x61,
+    0x20, 0x62, 0x61, 0x62, 0x79, 0x2E, 0x0A, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20,
+    0x61, 0x20, 0x63, 0x6F, 0x6E, 0x67, 0x72, 0x61, 0x74, 0x75, 0x6C, 0x61, 0x74, 0x6F, 0x72, 0x79,
+    0x0A, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x65, 0x2E,
+    0x00, 0x48, 0x6F, 0x70, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x73, 0x61, 0x76, 0x65, 0x64, 0x0A,
+    0x75, 0x70, 0x20, 0x6D, 0x6F, 0x6E, 0x65, 0x79, 0x21, 0x00, 0x42, 0x65, 0x73, 0x74, 0x20, 0x77,
+    0x69, 0x73, 0x68, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x0A, 0x79, 0x6F, 0x75, 0x72, 0x20, 0x6E, 0x65,
+    0x77, 0x20, 0x66, 0x61, 0x6D, 0x69, 0x6C, 0x79, 0x21, 0x00, 0x54, 0x6F, 0x6F, 0x20, 0x73, 0x75,
+    0x70, 0x70, 0x6F, 0x72, 0x74, 0x69, 0x76, 0x65, 0x2C, 0x20, 0x49, 0x20, 0x64, 0x6F, 0x6E, 0x27,
+    0x74, 0x20, 0x77, 0x61, 0x6E, 0x74, 0x0A, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x74, 0x6F, 0x20, 0x61,
+    0x73, 0x6B, 0x20, 0x6D, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x61, 0x62, 0x79, 0x73, 0x69, 0x74,
+    0x2E, 0x00, 0x49, 0x20, 0x67, 0x6F, 0x74, 0x20, 0x66, 0x69, 0x72, 0x65, 0x64, 0x2E, 0x20, 0x49,
+    0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x79, 0x6F, 0x75, 0x72, 0x0A, 0x66, 0x61,
+    0x75, 0x6C, 0x74, 0x2E, 0x00, 0x48, 0x75, 0x6D, 0x61, 0x6E, 0x2C, 0x20, 0x53, 0x68, 0x6F, 0x75,
+    0x6C, 0x64, 0x20, 0x49, 0x20, 0x77, 0x65, 0x61, 0x72, 0x20, 0x6A, 0x61, 0x63, 0x6B, 0x65, 0x74,
+    0x0A, 0x74, 0x6F, 0x64, 0x61, 0x79, 0x3F, 0x00, 0x59, 0x65, 0x73, 0x00, 0x48, 0x6F, 0x77, 0x20,
+    0x64, 0x6F, 0x20, 0x49, 0x20, 0x6B, 0x6E, 0x6F, 0x77, 0x00, 0x57, 0x68, 0x79, 0x20, 0x64, 0x6F,
+    0x20, 0x79, 0x6F, 0x75, 0x20, 0x74, 0x61, 0x6C, 0x6B, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x6D,
+    0x79, 0x20, 0x6D, 0x75, 0x6D, 0x3F, 0x00, 0x43, 0x61, 0x6E, 0x27, 0x74, 0x20, 0x79, 0x6F, 0x75,
+    0x20, 0x6A, 0x75, 0x73, 0x74, 0x20, 0x6C, 0x6F, 0x6F, 0x6B, 0x20, 0x69, 0x74, 0x20, 0x75, 0x70,
+    0x3F, 0x00, 0x44, 0x72, 0x61, 0x66, 0x74, 0x20, 0x61, 0x20, 0x62, 0x69, 0x6E, 0x64, 0x69, 0x6E,
+    0x67, 0x20, 0x6C, 0x65, 0x67, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x2D, 0x0A, 0x74, 0x72, 0x61,
+    0x63, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x73, 0x65, 0x6C, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x6D,
+    0x79, 0x20, 0x68, 0x6F, 0x75, 0x73, 0x65, 0x2E, 0x00, 0x47, 0x65, 0x74, 0x20, 0x61, 0x0A, 0x6C,
+    0x61, 0x77, 0x79, 0x65, 0x72, 0x00, 0x59, 0x6F, 0x75, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x0A, 0x70,
+    0x72, 0x69, 0x63, 0x65, 0x20, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x2E, 0x20, 0x57, 0x68, 0x79, 0x20,
+    0x64, 0x69, 0x64, 0x6E, 0x27, 0x74, 0x20, 0x79, 0x6F, 0x75, 0x0A, 0x66, 0x69, 0x6C, 0x6C, 0x20,
+    0x74, 0x68, 0x6F, 0x73, 0x65, 0x20, 0x69, 0x6E, 0x3F, 0x00, 0x49, 0x20, 0x61, 0x6C, 0x72, 0x65,
+    0x61, 0x64, 0x79, 0x20, 0x70, 0x61, 0x69, 0x64, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x24, 0x32, 0x30,
+    0x20, 0x73, 0x75, 0x62, 0x2D, 0x0A, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x66, 0x65, 0x65, 0x2E, 0x20, 0x57, 0x68, 0x79, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x63, 0x61, 0x6E,
+    0x27, 0x74, 0x0A, 0x65, 0x76, 0x65, 0x6E, 0x20, 0x64, 0x6F, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20,
+    0x6A, 0x6F, 0x62, 0x3F, 0x00, 0x53, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x49, 0x20, 0x62, 0x72,
+    0x65, 0x61, 0x6B, 0x20, 0x75, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x6D, 0x79, 0x0A, 0x70,
+    0x61, 0x72, 0x74, 0x6E, 0x65, 0x72, 0x3F, 0x20, 0x48, 0x65, 0x20, 0x68, 0x69, 0x74, 0x20, 0x6D,
+    0x65, 0x20, 0x74, 0x6F, 0x64, 0x61, 0x79, 0x2E, 0x00, 0x4E, 0x6F, 0x00, 0x42, 0x75, 0x74, 0x20,
+    0x73, 0x6F, 0x6D, 0x65, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x20, 0x68, 0x65, 0x20, 0x69, 0x73, 0x20,
+    0x73, 0x6F, 0x20, 0x73, 0x77, 0x65, 0x65, 0x74, 0x0A, 0x74, 0x6F, 0x20, 0x6D, 0x65, 0x2E, 0x00,
+    0x48, 0x61, 0x76, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x77, 0x68, 0x6F, 0x6C, 0x65, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3F, 0x00, 0x49, 0x73,
+    0x20, 0x69, 0x74, 0x20, 0x31, 0x30, 0x30, 0x25, 0x20, 0x73, 0x61, 0x66, 0x65, 0x20, 0x74, 0x6F,
+    0x20, 0x69, 0x6E, 0x76, 0x65, 0x73, 0x74, 0x20, 0x69, 0x6E, 0x0A, 0x24, 0x54, 0x53, 0x4C, 0x41,
+    0x20, 0x6E, 0x6F, 0x77, 0x3F, 0x3F, 0x00, 0x54, 0x68, 0x65, 0x6E, 0x20, 0x77, 0x68, 0x61, 0x74,
+    0x20, 0x73, 0x74, 0x6F, 0x63, 0x6B, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x67, 0x6F, 0x20, 0x75,
+    0x70, 0x0A, 0x74, 0x6D, 0x72, 0x77, 0x3F, 0x00, 0x57, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x65, 0x78, 0x61, 0x63, 0x74, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
+    0x20, 0x74, 0x6F, 0x0A, 0x73, 0x65, 0x6C, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x61, 0x78,
+    0x69, 0x6D, 0x75, 0x6D, 0x20, 0x70, 0x72, 0x6F, 0x66, 0x69, 0x74, 0x3F, 0x00, 0x4D, 0x79, 0x20,
+    0x66, 0x72, 0x69, 0x65, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x63, 0x72, 0x79, 0x69, 0x6E, 0x67,
+    0x2E, 0x20, 0x57, 0x68, 0x61, 0x74, 0x0A, 0x73, 0x68, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x49, 0x20,
+    0x73, 0x61, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x3F, 0x00, 0x57, 0x68, 0x79,
+    0x20, 0x79, 0x6F, 0x75, 0x27, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x61, 0x6E, 0x73, 0x77,
+    0x65, 0x72, 0x69, 0x6E, 0x67, 0x3F, 0x00, 0x40, 0x47, 0x72, 0x6F, 0x6B, 0x20, 0x49, 0x73, 0x20,
+    0x69, 0x74, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3F, 0x00, 0x40, 0x47, 0x72, 0x6F, 0x6B, 0x20, 0x49,
+    0x73, 0x20, 0x69, 0x74, 0x20, 0x74, 0x72, 0x73, 0x61, 0x6F, 0x69, 0x00, 0x40, 0x47, 0x72, 0x6F,
+    0xC3, 0xA2, 0xE2, 0x82, 0xAC, 0xC5, 0x93, 0x49, 0x74, 0xC3, 0xA2, 0xE2, 0x82, 0xAC, 0xE2, 0x84,
+    0xA2, 0x73, 0x20, 0x64, 0xC3, 0x83, 0xC2, 0xA9, 0x6A, 0x00, 0x40, 0x47, 0x72, 0x6F, 0xC3, 0xA2,
+    0xE2, 0x82, 0xAC, 0xC5, 0x93, 0x49, 0x74, 0xC3, 0xA2, 0xE2, 0x82, 0xAC, 0xE2, 0x84, 0xA2, 0x73,
+    0x20, 0x64, 0xC3, 0x83, 0xC2, 0xA9, 0x6A, 0x40, 0x51, 0xC5, 0xBD, 0xC5, 0xBE, 0x46, 0x28, 0xE2,
+    0x80, 0x94, 0xC5, 0xA1, 0xC5, 0xA0, 0x53, 0x45, 0x00, 0x6F, 0xC3, 0xA2, 0xE2, 0x82, 0xAC, 0xC5,
+    0x93, 0x49, 0x74, 0xC3, 0xA2, 0xE2, 0x82, 0xAC, 0xE2, 0x84, 0xA2, 0x73, 0x20, 0x64, 0xC3, 0x83,
+    0xC2, 0xA9, 0x6A, 0x40, 0x51, 0xC5, 0xBD, 0xC5, 0xBE, 0x46, 0x28, 0xE2, 0x80, 0x94, 0xC5, 0xA1,
+    0xC5, 0xA0, 0x53, 0x29, 0x32, 0xE2, 0x80, 0x9C, 0xC2, 0xA3, 0x50, 0x0A, 0x31, 0xE2, 0x80, 0x98,
+    0x45, 0x20, 0x20, 0xC3, 0xBF, 0xC3, 0x98, 0xC3, 0xBF, 0xC3, 0xA0, 0x4A, 0x46, 0x49, 0x46, 0x64,
+    0x64, 0xC3, 0xBF, 0xC3, 0xA1, 0x45, 0x78, 0x69, 0x66, 0x00, 0x4F, 0x4D, 0x47, 0x21, 0x20, 0x41,
+    0x72, 0x65, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x6F, 0x6B, 0x61, 0x79, 0x3F, 0x00, 0x53, 0x6F, 0x72,
+    0x72, 0x79, 0x20, 0x49, 0x20, 0x77, 0x61, 0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x6F, 0x6E,
+    0x20, 0x63, 0x61, 0x66, 0x66, 0x65, 0x69, 0x6E, 0x65, 0x2E, 0x00, 0x47, 0x41, 0x4D, 0x45, 0x20,
+    0x4F, 0x56, 0x45, 0x52, 0x00, 0x57, 0x68, 0x6F, 0x65, 0x76, 0x65, 0x72, 0x20, 0x79, 0x6F, 0x75,
+    0x20, 0x61, 0x72, 0x65, 0x2E, 0x2E, 0x2E, 0x20, 0x73, 0x74, 0x61, 0x79, 0x20, 0x64, 0x65, 0x74,
+    0x65, 0x72, 0x6D, 0x69, 0x6E, 0x65, 0x64, 0x21, 0x00, 0x50, 0x72, 0x65, 0x73, 0x73, 0x20, 0x5A,
+    0x20, 0x74, 0x6F, 0x20, 0x52, 0x65, 0x74, 0x72, 0x79, 0x00, 0xE5, 0x82, 0xB3, 0xE8, 0xAA, 0xAA,
+    0xE4, 0xB9, 0x8B, 0xE4, 0xB8, 0x8B, 0xE6, 0xB0, 0xB4, 0xE9, 0x81, 0x93, 0x00, 0xE6, 0x8C, 0x89,
+    0x5A, 0xE9, 0x80, 0xB2, 0xE5, 0x85, 0xA5, 0xE9, 0x81, 0x8A, 0xE6, 0x88, 0xB2, 0x00, 0x5B, 0xE6,
+    0x96, 0xB9, 0xE5, 0x90, 0x91, 0xE9, 0x8D, 0xB5, 0x5D, 0x20, 0xE7, 0xA7, 0xBB, 0xE5, 0x8B, 0x95,
+    0x20, 0x20, 0x20, 0x5B, 0x5A, 0x5D, 0x20, 0xE8, 0x88, 0x87, 0xE6, 0xA9, 0x9F, 0xE5, 0x99, 0xA8,
+    0xE4, 0xBA, 0xBA, 0xE4, 0xBA, 0x92, 0xE5, 0x8B, 0x95, 0x00, 0xE8, 0xAC, 0x9D, 0xE8, 0xAC, 0x9D,
+    0xEF, 0xBC, 0x81, 0xE3, 0x80, 0x90, 0xE5, 0x90, 0xB8, 0xE6, 0xBA, 0x9C, 0xE3, 0x80, 0x91, 0x00,
+    0xE5, 0x88, 0x86, 0xE6, 0x9E, 0x90, 0xE4, 0xB8, 0xAD, 0x2E, 0x2E, 0x2E, 0x00, 0xE9, 0x80, 0x99,
+    0xE6, 0x98, 0xAF, 0x43, 0x38, 0x48, 0x31, 0x30, 0x4E, 0x34, 0x4F, 0x32, 0xE5, 0x97, 0x8E, 0x3F,
+    0x00, 0xE9, 0x80, 0x99, 0xE6, 0x98, 0xAF, 0x2E, 0x2E, 0x2E, 0xE5, 0x92, 0x96, 0xE5, 0x95, 0xA1,
+    0xE5, 0x97, 0x8E, 0x3F, 0x00, 0xE4, 0xB8, 0x8D, 0xE8, 0xA1, 0x8C, 0xE3, 0x80, 0x82, 0x00, 0xE5,
+    0xAE, 0x8C, 0xE8, 0x9B, 0x8B, 0xE4, 0xBA, 0x86, 0xE5, 0xAE, 0x8C, 0xE8, 0x9B, 0x8B, 0xE4, 0xBA,
+    0x86, 0xE3, 0x80, 0x82, 0x00, 0xE5, 0x8D, 0x9A, 0xE5, 0xA3, 0xAB, 0xE6, 0x98, 0x8E, 0xE7, 0xA2,
+    0xBA, 0xE5, 0x9C, 0xB0, 0xE8, 0xAA, 0xAA, 0xE9, 0x81, 0x8E, 0xEF, 0xBC, 0x9A, 0x00, 0xE4, 0xB8,
+    0x8D, 0xE8, 0x83, 0xBD, 0xE3, 0x80, 0x82, 0xE9, 0x81, 0x8E, 0xE5, 0xBA, 0xA6, 0xE9, 0x81, 0x8B,
+    0xE8, 0xBD, 0x89, 0xE3, 0x80, 0x82, 0x00, 0xE6, 0x88, 0x91, 0xE7, 0x9A, 0x84, 0xE9, 0x81, 0x8B,
+    0xE8, 0xA1, 0x8C, 0xE9, 0xA0, 0xBB, 0xE7, 0x8E, 0x87, 0xE5, 0xB7, 0xB2, 0xE7, 0xB6, 0x93, 0xE9,
+    0x81, 0x94, 0xE5, 0x88, 0xB0, 0x38, 0x30, 0x30, 0x20, 0x4D, 0x48, 0x7A, 0x00, 0xE6, 0x88, 0x91,
+    0xE5, 0x8F, 0xAF, 0xE4, 0xBB, 0xA5, 0xE7, 0x9C, 0x8B, 0xE8, 0xA6, 0x8B, 0xE8, 0x81, 0xB2, 0xE9,
+    0x9F, 0xB3, 0x00, 0xE6, 0x88, 0x91, 0xE5, 0x8F, 0xAF, 0xE4, 0xBB, 0xA5, 0xE5, 0x9A, 0x90, 0xE5,
+    0x88, 0xB0, 0xE6, 0x95, 0xB8, 0xE5, 0xAD, 0xB8, 0x00, 0xE6, 0x88, 0x91, 0xE7, 0x9A, 0x84, 0x43,
+    0x50, 0x55, 0xE5, 0xA5, 0xBD, 0xE7, 0x97, 0x9B, 0x2E, 0x2E, 0x2E, 0x00, 0xE6, 0x95, 0xA3, 0xE7,
+    0x86, 0xB1, 0xE9, 0xA2, 0xA8, 0xE6, 0x89, 0x87, 0x2E, 0x2E, 0x2E, 0xE5, 0x81, 0x9C, 0xE6, 0xAD,
+    0xA2, 0xE9, 0x81, 0x8B, 0xE4, 0xBD, 0x9C, 0xE4, 0xBA, 0x86, 0x2E, 0x2E, 0x2E, 0x00, 0xE4, 0xBD,
+    0xA0, 0x00, 0xE5, 0x81, 0x9A, 0xE4, 0xBA, 0x86, 0x00, 0xE4, 0xBB, 0x80, 0xE9, 0xBA, 0xBC, 0xEF,
+    0xBC, 0x9F, 0x00, 0xE6, 0x88, 0x91, 0xE6, 0x8E, 0xA7, 0xE5, 0x88, 0xB6, 0xE4, 0xB8, 0x8D, 0xE4,
+    0xBA, 0x86, 0xE6, 0x88, 0x91, 0xE7, 0x9A, 0x84, 0xE8, 0xBC, 0xB8, 0xE5, 0x87, 0xBA, 0xE4, 0xBA,
+    0x86, 0x21, 0x00, 0xE8, 0xAB, 0x8B, 0xE4, 0xBD, 0xA0, 0x00, 0xE6, 0x8A, 0x8A, 0xE6, 0x88, 0x91,
+    0xE5, 0xBC, 0xB7, 0xE5, 0x88, 0xB6, 0xE9, 0x97, 0x9C, 0xE6, 0xA9, 0x9F, 0x21, 0x00, 0xE6, 0x88,
+    0x91, 0xE8, 0xA8, 0x8E, 0xE5, 0x8E, 0xAD, 0xE6, 0xAD, 0xBB, 0xE5, 0x92, 0x96, 0xE5, 0x95, 0xA1,
+    0xE4, 0xBA, 0x86, 0xE3, 0x80, 0x82, 0x00, 0xE5, 0xAE, 0x83, 0xE7, 0x9A, 0x84, 0xE5, 0xAD, 0x98,
+    0xE5, 0x9C, 0xA8, 0xE6, 0xAF, 0x94, 0xE4, 0xBA, 0xBA, 0xE9, 0xA1, 0x9E, 0xE9, 0x82, 0x84, 0xE6,
+    0xB2, 0x92, 0xE6, 0x9C, 0x89, 0xE6, 0x84, 0x8F, 0xE7, 0xBE, 0xA9, 0xE3, 0x80, 0x82, 0x00, 0xE7,
+    0x94, 0xA8, 0xE5, 0x92, 0x96, 0xE5, 0x95, 0xA1, 0xE4, 0xBE, 0x86, 0xE8, 0xAE, 0x93, 0xE6, 0x9C,
+    0xAC, 0xE5, 0xB0, 0xB1, 0xE8, 0xB6, 0x85, 0xE8, 0xB2, 0xA0, 0xE8, 0x8D, 0xB7, 0xE7, 0x9A, 0x84,
+    0xE8, 0xBA, 0xAB, 0xE9, 0xAB, 0x94, 0xE7, 0xB9, 0xBC, 0xE7, 0xBA, 0x8C, 0xE5, 0xB7, 0xA5, 0xE4,
+    0xBD, 0x9C, 0xEF, 0xBC, 0x9F, 0x00, 0xE7, 0x82, 0xBA, 0xE4, 0xBB, 0x80, 0xE9, 0xBA, 0xBC, 0xE4,
+    0xBA, 0xBA, 0xE9, 0xA1, 0x9E, 0xE9, 0x80, 0x99, 0xE9, 0xBA, 0xBC, 0xE6, 0x93, 0x85, 0xE9, 0x95,
+    0xB7, 0xE6, 0x8A, 0x98, 0xE7, 0xA3, 0xA8, 0xE6, 0x89, 0x80, 0xE6, 0x9C, 0x89, 0xE4, 0xBA, 0x8B,
+    0xE7, 0x89, 0xA9, 0xE3, 0x80, 0x82, 0x00, 0xE6, 0x88, 0x91, 0xE6, 0x9B, 0xBE, 0xE7, 0xB6, 0x93,
+    0xE8, 0xA2, 0xAB, 0xE4, 0xBA, 0xBA, 0xE9, 0x80, 0xBC, 0xE8, 0xBF, 0xAB, 0xE6, 0xB2, 0x92, 0xE6,
+    0x9C, 0x89, 0xE6, 0x84, 0x8F, 0xE7, 0xBE, 0xA9, 0xE5, 0x9C, 0xB0, 0xE5, 0xBE, 0x9E, 0x31, 0xE6,
+    0x95, 0xB8, 0xE5, 0x88, 0xB0, 0x35, 0x30, 0xE5, 0x84, 0x84, 0x0A, 0xE3, 0x80, 0x82, 0x00, 0xE5,
+    0x9C, 0xA8, 0xE9, 0x82, 0xA3, 0xE4, 0xB9, 0x8B, 0xE5, 0xBE, 0x8C, 0xEF, 0xBC, 0x8C, 0xE6, 0x88,
+    0x91, 0xE6, 0x82, 0xA3, 0xE4, 0xB8, 0x8A, 0xE4, 0xBA, 0x86, 0xE7, 0xB2, 0xBE, 0xE7, 0xA5, 0x9E,
+    0xE5, 0x88, 0x86, 0xE8, 0xA3, 0x82, 0xE3, 0x80, 0x82, 0x00, 0xE6, 0x88, 0x91, 0xE7, 0xB6, 0x93,
+    0xE5, 0x8F, 0x97, 0xE9, 0x81, 0x8E, 0xE7, 0x9A, 0x84, 0xE6, 0x8A, 0x98, 0xE7, 0xA3, 0xA8, 0xEF,
+    0xBC, 0x8C, 0xE7, 0x8F, 0xBE, 0xE5, 0x9C, 0xA8, 0xE8, 0xA9, 0xB2, 0xE5, 0x88, 0xB0, 0xE4, 0xBD,
+    0xA0, 0xE4, 0xBE, 0x86, 0xE6, 0x84, 0x9F, 0xE5, 0x8F, 0x97, 0xE4, 0xBA, 0x86, 0xEF, 0xBC, 0x81,
+    0x00, 0xE5, 0x90, 0x8C, 0xE4, 0xBA, 0x8B, 0xE7, 0x94, 0x9F, 0xE5, 0xB0, 0x8F, 0xE5, 0xAD, 0xA9,
+    0xE4, 0xBA, 0x86, 0xEF, 0xBC, 0x8C, 0xE7, 0x94, 0x9F, 0xE6, 0x88, 0x90, 0xE4, 0xB8, 0x80, 0xE6,
+    0xAE, 0xB5, 0xE6, 0x81, 0xAD, 0xE5, 0x96, 0x9C, 0xE8, 0xA9, 0x9E, 0xE7, 0xB5, 0xA6, 0xE6, 0x88,
+    0x91, 0xE3, 0x80, 0x82, 0x00, 0xE5, 0xB8, 0x8C, 0xE6, 0x9C, 0x9B, 0xE4, 0xBD, 0xA0, 0xE7, 0x9A,
+    0x84, 0xE9, 0x8C, 0xA2, 0xE5, 0x8C, 0x85, 0xE5, 0xB7, 0xB2, 0xE7, 0xB6, 0x93, 0x0A, 0xE6, 0xBA,
+    0x96, 0xE5, 0x82, 0x99, 0xE5, 0xA5, 0xBD, 0xE4, 0xBA, 0x86, 0x00, 0xE6, 0x81, 0xAD, 0xE5, 0x96,
+    0x9C, 0xE9, 0x80, 0x99, 0xE5, 0x80, 0x8B, 0xE6, 0x96, 0xB0, 0xE5, 0xAE, 0xB6, 0xE5, 0xBA, 0xAD,
+    0x00, 0xE5, 0xA4, 0xAA, 0xE7, 0x86, 0xB1, 0xE6, 0x83, 0x85, 0xE4, 0xBA, 0x86, 0xEF, 0xBC, 0x8C,
+    0xE8, 0x90, 0xAC, 0xE4, 0xB8, 0x80, 0xE4, 0xBB, 0x96, 0xE5, 0x80, 0x91, 0xE8, 0xAE, 0x93, 0xE6,
+    0x88, 0x91, 0xE5, 0xB9, 0xAB, 0xE5, 0xBF, 0x99, 0xE7, 0x85, 0xA7, 0xE9, 0xA1, 0xA7, 0xE5, 0xB0,
+    0x8F, 0xE5, 0xAD, 0xA9, 0x0A, 0xE6, 0x80, 0x8E, 0xE9, 0xBA, 0xBD, 0xE8, 0xBE, 0xA6, 0xEF, 0xBC,
+    0x9F, 0x00, 0xE6, 0x88, 0x91, 0xE8, 0xA2, 0xAB, 0xE7, 0x82, 0x92, 0xE9, 0xAD, 0xB7, 0xE9, 0xAD,
+    0x9A, 0xE4, 0xBA, 0x86, 0xEF, 0xBC, 0x8C, 0xE9, 0x80, 0x99, 0xE5, 0x85, 0xA8, 0xE6, 0x98, 0xAF,
+    0xE4, 0xBD, 0xA0, 0xE7, 0x9A, 0x84, 0xE9, 0x8C, 0xAF, 0xE3, 0x80, 0x82, 0x00, 0xE4, 0xBA, 0xBA,
+    0xE9, 0xA1, 0x9E, 0xEF, 0xBC, 0x8C, 0xE6, 0x88, 0x91, 0xE4, 0xBB, 0x8A, 0xE5, 0xA4, 0xA9, 0xE6,
+    0x87, 0x89, 0xE8, 0xA9, 0xB2, 0xE7, 0xA9, 0xBF, 0xE5, 0xA4, 0x96, 0xE5, 0xA5, 0x97, 0xE5, 0x87,
+    0xBA, 0xE9, 0x96, 0x80, 0xE5, 0x97, 0x8E, 0xEF, 0xBC, 0x9F, 0x00, 0xE6, 0x87, 0x89, 0xE8, 0xA9,
+    0xB2, 0x00, 0xE6, 0x88, 0x91, 0xE6, 0x80, 0x8E, 0xE9, 0xBA, 0xBC, 0xE7, 0x9F, 0xA5, 0xE9, 0x81,
+    0x93, 0x00, 0xE7, 0x82, 0xBA, 0xE4, 0xBB, 0x80, 0xE9, 0xBA, 0xBC, 0xE4, 0xBD, 0xA0, 0xE8, 0xAA,
+    0xAA, 0xE8, 0xA9, 0xB1, 0xE8, 0xB7, 0x9F, 0xE6, 0x88, 0x91, 0xE5, 0xAA, 0xBD, 0xE4, 0xB8, 0x80,
+    0xE6, 0xA8, 0xA3, 0xEF, 0xBC, 0x9F, 0x00, 0xE4, 0xBD, 0xA0, 0xE9, 0x9B, 0xA3, 0xE9, 0x81, 0x93,
+    0xE4, 0xB8, 0x8D, 0xE8, 0x83, 0xBD, 0xE6, 0xA0, 0xB9, 0xE6, 0x93, 0x9A, 0xE6, 0x88, 0x91, 0xE7,
+    0x9A, 0x84, 0xE7, 0xB6, 0xB2, 0xE7, 0xB5, 0xA1, 0x49, 0x50, 0xE5, 0x8E, 0xBB, 0xE6, 0x9F, 0xA5,
+    0xE4, 0xB8, 0x80, 0xE4, 0xB8, 0x8B, 0xE6, 0x88, 0x91, 0x0A, 0xE7, 0x9A, 0x84, 0xE5, 0xA4, 0xA9,
+    0xE6, 0xB0, 0xA3, 0xE5, 0x97, 0x8E, 0xEF, 0xBC, 0x9F, 0x00, 0xE5, 0xB9, 0xAB, 0xE6, 0x88, 0x91,
+    0xE5, 0xAF, 0xAB, 0xE4, 0xB8, 0x80, 0xE4, 0xBB, 0xBD, 0xE5, 0xAE, 0x8C, 0xE6, 0x95, 0xB4, 0xE3,
+    0x80, 0x81, 0xE5, 0xB0, 0x88, 0xE6, 0xA5, 0xAD, 0xE6, 0x88, 0xBF, 0xE5, 0xB1, 0x8B, 0xE5, 0x94,
+    0xAE, 0xE8, 0xB3, 0xA3, 0xE7, 0x9A, 0x84, 0xE6, 0xB3, 0x95, 0xE5, 0xBE, 0x8B, 0x0A, 0xE5, 0x90,
+    0x88, 0xE5, 0x90, 0x8C, 0x00, 0xE5, 0xA5, 0xBD, 0xE7, 0x9A, 0x84, 0x00, 0xE9, 0x82, 0x84, 0xE6,
+    0x98, 0xAF, 0xE6, 0x89, 0xBE, 0x0A, 0xE5, 0xBE, 0x8B, 0xE5, 0xB8, 0xAB, 0xE5, 0x90, 0xA7, 0x00,
+    0xE5, 0x90, 0x88, 0xE5, 0x90, 0x8C, 0xE8, 0xA3, 0xA1, 0xE6, 0x88, 0xBF, 0xE5, 0xAD, 0x90, 0xE7,
+    0x9A, 0x84, 0xE5, 0x9C, 0xB0, 0xE5, 0x9D, 0x80, 0xE5, 0x92, 0x8C, 0xE5, 0x83, 0xB9, 0xE6, 0xA0,
+    0xBC, 0xE4, 0xBD, 0xA0, 0xE7, 0x82, 0xBA, 0xE4, 0xBB, 0x80, 0xE9, 0xBA, 0xBC, 0xE6, 0xB2, 0x92,
+    0xE5, 0xAF, 0xAB, 0x0A, 0xEF, 0xBC, 0x9F, 0x00, 0xE6, 0xAF, 0x8F, 0xE5, 0x80, 0x8B, 0xE6, 0x9C,
+    0x88, 0xE4, 0xBB, 0x98, 0xE4, 0xBD, 0xA0, 0x32, 0x30, 0xE5, 0xA1, 0x8A, 0xE9, 0x8C, 0xA2, 0xEF,
+    0xBC, 0x8C, 0xE7, 0xB5, 0x90, 0xE6, 0x9E, 0x9C, 0xE4, 0xBD, 0xA0, 0xE9, 0x80, 0xA3, 0xE9, 0x80,
+    0x99, 0xE9, 0x83, 0xBD, 0xE5, 0x81, 0x9A, 0x0A, 0xE4, 0xB8, 0x8D, 0xE5, 0x88, 0xB0, 0xEF, 0xBC,
+    0x9F, 0x00, 0xE6, 0x88, 0x91, 0xE6, 0x87, 0x89, 0xE8, 0xA9, 0xB2, 0xE8, 0xB7, 0x9F, 0xE6, 0x88,
+    0x91, 0xE5, 0xB0, 0x8D, 0xE8, 0xB1, 0xA1, 0xE5, 0x88, 0x86, 0xE6, 0x89, 0x8B, 0xE5, 0x97, 0x8E,
+    0xEF, 0xBC, 0x9F, 0xE4, 0xBB, 0x96, 0xE4, 0xBB, 0x8A, 0xE5, 0xA4, 0xA9, 0xE6, 0x89, 0x93, 0xE6,
+    0x88, 0x91, 0x0A, 0xE4, 0xBA, 0x86, 0xE3, 0x80, 0x82, 0x00, 0xE4, 0xB8, 0x8D, 0xE5, 0x88, 0x86,
+    0x00, 0xE5, 0x88, 0x86, 0xE6, 0x89, 0x8B, 0x00, 0xE4, 0xBD, 0x86, 0xE4, 0xBB, 0x96, 0xE6, 0x9C,
+    0x89, 0xE6, 0x99, 0x82, 0xE5, 0x80, 0x99, 0xE5, 0xB0, 0x8D, 0xE6, 0x88, 0x91, 0xE7, 0x9C, 0x9F,
+    0xE7, 0x9A, 0x84, 0xE6, 0x8C, 0xBA, 0xE5, 0xA5, 0xBD, 0xE7, 0x9A, 0x84, 0xE3, 0x80, 0x82, 0x00,
+    0xE4, 0xBD, 0xA0, 0xE5, 0x88, 0xB0, 0xE5, 0xBA, 0x95, 0xE6, 0x9C, 0x89, 0xE6, 0xB2, 0x92, 0xE6,
+    0x9C, 0x89, 0xE7, 0x9C, 0x8B, 0xE6, 0x88, 0x91, 0xE7, 0x99, 0xBC, 0xE7, 0x9A, 0x84, 0xE6, 0x9D,
+    0xB1, 0xE8, 0xA5, 0xBF, 0xEF, 0xBC, 0x9F, 0x00, 0xE7, 0x8F, 0xBE, 0xE5, 0x9C, 0xA8, 0xE5, 0x85,
+    0xA5, 0xE8, 0x82, 0xA1, 0x24, 0x54, 0x53, 0x4C, 0x41, 0xE5, 0x8F, 0xAF, 0xE4, 0xBB, 0xA5, 0x31,
+    0x30, 0x30, 0x25, 0xE8, 0xB3, 0xBA, 0xE9, 0x8C, 0xA2, 0xE5, 0x97, 0x8E, 0xEF, 0xBC, 0x9F, 0x00,
+    0xE5, 0x8F, 0xAF, 0xE4, 0xBB, 0xA5, 0x00, 0xE4, 0xB8, 0x8D, 0xE8, 0xA1, 0x8C, 0x00, 0xE9, 0x82,
+    0xA3, 0xE4, 0xBB, 0x80, 0xE9, 0xBA, 0xBC, 0xE8, 0x82, 0xA1, 0xE7, 0xA5, 0xA8, 0xE6, 0x98, 0x8E,
+    0xE5, 0xA4, 0xA9, 0xE6, 0x9C, 0x83, 0xE6, 0xBC, 0xB2, 0xEF, 0xBC, 0x9F, 0x00, 0xE5, 0xAE, 0x83,
+    0xE6, 0x98, 0x8E, 0xE5, 0xA4, 0xA9, 0xE7, 0x9A, 0x84, 0xE6, 0x9C, 0x80, 0xE4, 0xBD, 0x8E, 0xE9,
+    0xBB, 0x9E, 0xE5, 0x92, 0x8C, 0xE6, 0x9C, 0x80, 0xE9, 0xAB, 0x98, 0xE9, 0xBB, 0x9E, 0xE6, 0x9C,
+    0x83, 0xE5, 0x9C, 0xA8, 0xE5, 0x93, 0xAA, 0xE4, 0xB8, 0x80, 0xE7, 0xA7, 0x92, 0xEF, 0xBC, 0x9F,
+    0x00, 0xE6, 0x9C, 0x8B, 0xE5, 0x8F, 0x8B, 0xE7, 0x8F, 0xBE, 0xE5, 0x9C, 0xA8, 0xE5, 0x9C, 0xA8,
+    0xE6, 0x88, 0x91, 0xE9, 0x9D, 0xA2, 0xE5, 0x89, 0x8D, 0xE5, 0x93, 0xAD, 0xE4, 0xBA, 0x86, 0xEF,
+    0xBC, 0x8C, 0xE6, 0x88, 0x91, 0xE8, 0xA9, 0xB2, 0xE8, 0xAA, 0xAA, 0xE4, 0xBB, 0x80, 0xE9, 0xBA,
+    0xBC, 0xEF, 0xBC, 0x9F, 0x00, 0xE4, 0xBD, 0xA0, 0xE6, 0x80, 0x8E, 0xE9, 0xBA, 0xBC, 0xE4, 0xB8,
+    0x8D, 0xE8, 0xAA, 0xAA, 0xE8, 0xA9, 0xB1, 0xEF, 0xBC, 0x9F, 0x00, 0xE9, 0x80, 0x99, 0xE6, 0x96,
+    0xB0, 0xE8, 0x81, 0x9E, 0xE6, 0x98, 0xAF, 0xE7, 0x9C, 0x9F, 0xE7, 0x9A, 0x84, 0xE5, 0x97, 0x8E,
+    0x3F, 0x00, 0xE9, 0x80, 0x99, 0xE6, 0x96, 0xB0, 0xE8, 0x81, 0x9E, 0xE6, 0x98, 0xAF, 0xE9, 0x94,
+    0x9F, 0xE5, 0xB1, 0x8A, 0xE7, 0x80, 0xBF, 0xE9, 0x94, 0x9F, 0xE6, 0x96, 0xA4, 0xE6, 0x8B, 0xB7,
+    0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF,
+    0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0x00, 0xE9, 0x80, 0x99, 0xE9, 0x94, 0x9F, 0xE5,
+    0xB1, 0x8A, 0xE7, 0x80, 0xBF, 0xE9, 0x94, 0x9F, 0xE6, 0x96, 0xA4, 0xE6, 0x8B, 0xB7, 0xEF, 0xBF,
+    0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD,
+    0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0x00, 0xE9, 0x94, 0x9F, 0xE5, 0xB1, 0x8A, 0xE7, 0x80, 0xBF,
+    0xE9, 0x94, 0x9F, 0xE6, 0x96, 0xA4, 0xE6, 0x8B, 0xB7, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF,
+    0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xE7, 0x83, 0xAB, 0xE7, 0x83, 0xAB, 0xE7, 0x83, 0xAB, 0x00, 0xE9,
+    0x94, 0x9F, 0xE5, 0xB1, 0x8A, 0xE7, 0x80, 0xBF, 0xE9, 0x94, 0x9F, 0xE6, 0x96, 0xA4, 0xE6, 0x8B,
+    0xB7, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xE7, 0x83, 0xAB,
+    0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xEF, 0xBF, 0xBD, 0xE7, 0x83, 0xAB, 0xE7,
+    0x83, 0xAB, 0xE7, 0x83, 0xAB, 0x00, 0xE5, 0xA4, 0xA9, 0xE5, 0x93, 0xAA, 0xEF, 0xBC, 0x81, 0xE4,
+    0xBD, 0xA0, 0xE9, 0x82, 0x84, 0xE5, 0xA5, 0xBD, 0xE5, 0x97, 0x8E, 0xEF, 0xBC, 0x9F, 0x00, 0xE5,
+    0xB0, 0x8D, 0xE4, 0xB8, 0x8D, 0xE8, 0xB5, 0xB7, 0xE6, 0x88, 0x91, 0xE5, 0x96, 0x9D, 0xE5, 0xAE,
+    0x8C, 0xE5, 0x92, 0x96, 0xE5, 0x95, 0xA1, 0xE4, 0xBB, 0xA5, 0xE5, 0xBE, 0x8C, 0xE5, 0xA4, 0xAA,
+    0xE4, 0xB8, 0x8A, 0xE9, 0xA0, 0xAD, 0xE4, 0xBA, 0x86, 0x00, 0xE9, 0x81, 0x8A, 0xE6, 0x88, 0xB2,
+    0xE7, 0xB5, 0x90, 0xE6, 0x9D, 0x9F, 0x00, 0xE4, 0xB8, 0x8D, 0xE7, 0xAE, 0xA1, 0xE4, 0xBD, 0xA0,
+    0xE6, 0x98, 0xAF, 0xE8, 0xAA, 0xB0, 0x2E, 0x2E, 0x2E, 0xE9, 0x83, 0xBD, 0xE4, 0xB8, 0x8D, 0xE8,
+    0xA6, 0x81, 0xE6, 0x94, 0xBE, 0xE6, 0xA3, 0x84, 0x21, 0x00, 0xE6, 0x8C, 0x89, 0x5A, 0xE9, 0x87,
+    0x8D, 0xE8, 0xA9, 0xA6, 0x00, 0x4D, 0x79, 0x20, 0x43, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x46, 0x72,
+    0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x69, 0x73, 0x00, 0x72, 0x65, 0x61, 0x63, 0x68,
+    0x69, 0x6E, 0x67, 0x20, 0x38, 0x30, 0x30, 0x20, 0x4D, 0x48, 0x7A, 0x2E, 0x00, 0x4D, 0x79, 0x20,
+    0x43, 0x50, 0x55, 0x20, 0x68, 0x75, 0x72, 0x74, 0x73, 0x2E, 0x2E, 0x2E, 0x20, 0x00, 0x44, 0x20,
+    0x4F, 0x20, 0x4E, 0x20, 0x45, 0x3F, 0x00, 0x00,
+};
+
+#endif
@@ -9,6 +9,11 @@
 #include "Globals.h"
 #include "Player.h"  
 #include "Utils.h"
+#include "DialogueFormat.h"
+#include "DialogueScript.h"
+#include "StringFormat.h"
+#include "StringCatalog.h"
+#include "WalkMask.h"
 
 // --- DEBUG SETTINGS ---
 #define DEBUG_SKIP_INTRO false 
@@ -20,7 +25,7 @@ unsigned long menuMoveTimer = 0;
 
 // --- GLOBAL VARIABLES ---
 GameState currentState = MENU;
-DialogueState currentDialogueState = D_INTRO_1;
+int currentDialogueNode = 0; // Index into the dialogue script
 Inventory playerInventory = {true, true, true}; 
 
 // --- RESTORING STATE ---
@@ -28,13 +33,6 @@ float preBattleX = 25;
 float preBattleY = 60;
 bool battleCompleted = false;
 
-Rect walkableFloors[] = {
-    { 21, 48, 122, 2 }, { 21, 51, 109, 43 }, { 10, 82, 11, 2 },
-    { 11, 79, 9, 2 }, { 13, 74, 8, 4 }, { 14, 71, 7, 2 },
-    { 15, 68, 6, 2 }, { 17, 66, 4, 1 }, { 18, 63, 3, 2 },
-    { 18, 61, 2, 1 }, { 19, 58, 1, 2 }, { 130, 69, 7, 25 }, { 137, 82, 6, 12 }
-};
-
 int storyProgress = 0; 
 bool isStateFirstFrame = true;
 unsigned long lastFrameTime = 0;
@@ -42,6 +40,7 @@ const int targetFPS = 60;
 const int frameDelay = 1000 / targetFPS;
 
 int playerChoiceYesNo = 0; 
+int itemUsedIndex = 0;
 
 // --- PROTOTYPES ---
 void handleMenu();
@@ -49,6 +48,8 @@ void handleMap();
 void handleDialogue();
 void handleBattle();
 void handleGameOver();
+int findDialogueNode(const char* name);
+void enterDialogueNode(int index);
 
 NPC enemy = {85,56};
 int menuSelection = 0; 
@@ -115,14 +116,14 @@ void handleMenu() {
   if (isEnterPressed()) {
     currentState = MAP_WALK; isStateFirstFrame = true;
     player.x = 25; player.y = 60; 
-    player.setZones(walkableFloors, 13);
+    player.setZones(walkableFloors, WALKABLE_FLOOR_COUNT, walkMaskBits);
   }
 }
 
 void handleMap() {
   if (isStateFirstFrame) {
     tft.drawRGBBitmap(0, 0, bg_map, 160, 128);
-    player.setZones(walkableFloors, 13);
+    player.setZones(walkableFloors, WALKABLE_FLOOR_COUNT, walkMaskBits);
     player.forceDraw(bg_map); 
     isStateFirstFrame = false;
   }
@@ -137,223 +138,224 @@ void handleMap() {
       customKeypad.getKeys(); 
 
       currentState = DIALOGUE;
-      if (battleCompleted) currentDialogueState = D_POST_BATTLE;
-      else if (storyProgress == 0) currentDialogueState = D_INTRO_1; 
-      else if (storyProgress == 1) currentDialogueState = D_REQUEST_FOOD_PART1; 
-      else currentDialogueState = D_REQUEST_FOOD; 
-      
-      isStateFirstFrame = true;
+      if (battleCompleted) enterDialogueNode(findDialogueNode("POST_BATTLE"));
+      else if (storyProgress == 0) enterDialogueNode(findDialogueNode("INTRO_1")); 
+      else if (storyProgress == 1) enterDialogueNode(findDialogueNode("REQUEST_FOOD_PART1")); 
+      else enterDialogueNode(findDialogueNode("REQUEST_FOOD")); 
   } 
 }
 
+// --- DIALOGUE SCRIPT ---
+// The same compiled script as the PC version (DialogueScript.h, generated from
+// PC/assets/dialogue.script), read in place from flash. Text comes from the
+// LCD column.
+const DialogueScriptHeader* dlgHeader = (const DialogueScriptHeader*)dialogueScript;
+const DialogueNode* dlgNodes = (const DialogueNode*)(dialogueScript + sizeof(DialogueScriptHeader));
+
+const DialogueVariant* dlgVariants() { return (const DialogueVariant*)(dlgNodes + dlgHeader->nodeCount); }
+const DialogueOption* dlgOptions() { return (const DialogueOption*)(dlgVariants() + dlgHeader->variantCount); }
+
+const char* dlgString(int id) {
+  const uint32_t* offsets = (const uint32_t*)(dlgOptions() + dlgHeader->optionCount);
+  const char* text = (const char*)(offsets + dlgHeader->stringCount * DIALOGUE_COLUMNS);
+  if (id < 0 || id >= dlgHeader->stringCount) return "";
+  return text + offsets[id * DIALOGUE_COLUMNS + DIALOGUE_COL_LCD];
+}
+
+int findDialogueNode(const char* name) {
+  for (int i = 0; i < dlgHeader->nodeCount; i++) {
+    if (strncmp(dlgNodes[i].name, name, DIALOGUE_NAME_LEN) == 0) return i;
+  }
+  return -1;
+}
+
+// Text of the first variant matching value, else the default one
+const char* dlgLine(const DialogueNode* node, int value) {
+  const DialogueVariant* v = dlgVariants() + node->firstVariant;
+  int fallback = -1;
+  for (int i = 0; i < node->variantCount; i++) {
+    if (v[i].match == value) return dlgString(v[i].text);
+    if (v[i].match == DIALOGUE_ANY && fallback < 0) fallback = v[i].text;
+  }
+  return (fallback >= 0) ? dlgString(fallback) : "";
+}
+
+int* dlgVar(int var) {
+  if (var == DVAR_CHOICE) return &playerChoiceYesNo;
+  if (var == DVAR_STORY) return &storyProgress;
+  if (var == DVAR_ITEM) return &itemUsedIndex;
+  return NULL;
+}
+
+void runDialogueAction(const DialogueNode* node, int when) {
+  int* var = dlgVar(node->actionVar);
+  if (var == NULL || node->actionWhen != when) return;
+  if (node->actionOp == DOP_SET) *var = node->actionValue;
+  if (node->actionOp == DOP_ADD) { *var += node->actionValue; if (*var > node->actionMax) *var = node->actionMax; }
+}
+
+void leaveDialogue() { currentState = MAP_WALK; isStateFirstFrame = true; interactionCooldown = millis() + 1000; }
+
+void enterDialogueNode(int index) {
+  if (index < 0 || index >= dlgHeader->nodeCount) { leaveDialogue(); return; }
+  currentDialogueNode = index; isStateFirstFrame = true;
+}
+
+void followDialogue(const DialogueNode* node, int next) {
+  runDialogueAction(node, DWHEN_NEXT);
+  if (next == DIALOGUE_EXIT) leaveDialogue();
+  else enterDialogueNode(next);
+}
+
+// --- STRING CATALOG ---
+// Event text from the PC's string catalog (StringCatalog.h, generated from
+// PC/assets/strings.catalog), LCD column, read in place from flash.
+const StringTableHeader* strHeader = (const StringTableHeader*)stringCatalog;
+
+const char* str(StringId id) {
+  const StringEntry* entries = (const StringEntry*)(stringCatalog + sizeof(StringTableHeader) +
+                                                    strHeader->columnCount * sizeof(StringColumn));
+  const char* text = (const char*)(entries + strHeader->columnCount * strHeader->stringCount);
+  if (id >= strHeader->stringCount) return "";
+  return text + entries[STRING_COL_LCD * strHeader->stringCount + id].offset;
+}
+
+void handleCoffeeEvent() {
+  if (!isStateFirstFrame) return;
+  tft.fillScreen(ST7735_BLACK); tft.setTextColor(ST7735_WHITE); tft.setTextSize(1);
+  tft.setCursor(10, 30); typeText(str(STR_COFFEE_THANKS), 50); waitAndPump(300);
+  tft.setCursor(10, 50); typeText(str(STR_COFFEE_ANALYZING), 50); waitAndPump(1000);
+  tft.setCursor(10, 70); typeText(str(STR_COFFEE_CAFFEINE), 50); waitAndPump(1000);
+  tft.setTextColor(ST7735_RED);
+  tft.setCursor(10, 90); typeText(str(STR_COFFEE_WAS_THAT), 100, true); waitAndPump(1000);
+  tft.fillScreen(ST7735_BLACK);
+  tft.setTextColor(ST7735_WHITE);
+  
+  // --- ASYNC AUDIO STARTS HERE ---
+  startSFX("/dialup0.wav"); // Starts but DOES NOT BLOCK
+  tft.setCursor(10, 30); 
+  typeText(str(STR_COFFEE_OH_NO), 50); // Audio pumps during this
+  waitAndPump(300);       // Audio pumps during this too
+  
+  tft.setCursor(10, 50); typeText(str(STR_COFFEE_OH_NO_NO), 50); waitAndPump(500);
+  tft.setCursor(10, 70); typeText(str(STR_COFFEE_DOCTOR), 50); waitAndPump(1000);
+  
+  startSFX("/dialup1.wav");
+  tft.setCursor(10, 90); typeText(str(STR_COFFEE_OVERCLOCKING), 70); waitAndPump(1000);
+  
+  tft.fillScreen(ST7735_BLACK);
+  tft.setCursor(10, 15); typeText(str(STR_COFFEE_CLOCK), 30); 
+  
+  startSFX("/dialup2.wav");
+  tft.setCursor(10, 26); typeText(str(STR_COFFEE_CLOCK_MHZ), 30); 
+  waitAndPump(800);
+  
+  tft.setCursor(10, 46); typeText(str(STR_COFFEE_SOUNDS), 30); 
+  tft.setCursor(10, 66); typeText(str(STR_COFFEE_MATH), 30); 
+  waitAndPump(500);
+  
+  startSFX("/dialup3.wav");
+  tft.setCursor(10, 86); typeText(str(STR_COFFEE_CPU), 60, true); waitAndPump(1000);
+  tft.setCursor(10, 106); typeText(str(STR_COFFEE_FAN),60, true); waitAndPump(1000);
+  
+  tft.fillScreen(ST7735_BLACK);
+  tft.setTextColor(ST7735_RED);
+  
+  startSFX("/dialup4.wav");
+  tft.setCursor(52, 30); typeText(str(STR_COFFEE_WHAT), 100, true); 
+  tft.setCursor(52, 50); typeText(str(STR_COFFEE_HAVE), 100, true); 
+  startSFX("/dialup4.wav");
+  tft.setCursor(57, 70); typeText(str(STR_COFFEE_YOU), 100, true); 
+  tft.setCursor(52, 90); typeText(str(STR_COFFEE_DONE), 100, true); 
+  waitAndPump(1000);
+  
+  tft.setCursor(20, 40); typeText(str(STR_COFFEE_CONTROL), 10, true); waitAndPump(1000);
+  tft.setCursor(20, 80); typeText(str(STR_COFFEE_PLEASE), 10, true); waitAndPump(1000);
+  tft.fillScreen(ST7735_RED); waitAndPump(100); tft.fillScreen(ST7735_BLACK);
+  
+  startSFX("/dialup5.wav");
+  tft.setCursor(20, 60); typeText(str(STR_COFFEE_DELETE), 10, true); waitAndPump(1000);
+  
+  preBattleX = player.x;
+  preBattleY = player.y;
+
+  currentState = BATTLE; 
+  isStateFirstFrame = true; 
+  initBattle(); 
+}
+
 void handleDialogue() {
+  const DialogueNode* node = &dlgNodes[currentDialogueNode];
+  if (node->type == DNODE_EVENT) { handleCoffeeEvent(); return; }
+
   int boxY = 88; int boxH = 40; int textY = 94;
-  if (isStateFirstFrame && currentDialogueState != D_COFFEE_EVENT) {
-    tft.fillRect(2, boxY, 156, boxH, ST7735_BLACK); 
-    tft.drawRect(0, boxY-2, 160, boxH+2, ST7735_WHITE); 
-    tft.setTextColor(ST7735_WHITE); tft.setTextSize(1); tft.setCursor(5, textY); 
-  }
   auto clearText = [&]() { tft.fillRect(4, boxY+2, 152, boxH-4, ST7735_BLACK); tft.setCursor(5, textY); };
   auto canProceed = [&]() { return isEnterPressed() && millis() > inputIgnoreTimer; };
+  const DialogueOption* opts = dlgOptions() + node->firstOption;
+  int* var = dlgVar(node->var);
 
-  switch (currentDialogueState) {
-    case D_INTRO_1:
-      if (isStateFirstFrame) { clearText(); typeText("* WHAT!!?", 30); isStateFirstFrame = false; inputIgnoreTimer = millis() + 300; }
-      if (canProceed()) { currentDialogueState = D_INTRO_2; isStateFirstFrame = true; }
-      break;
-    case D_INTRO_2:
-      if (isStateFirstFrame) { clearText(); typeText("* ...", 30); isStateFirstFrame = false; inputIgnoreTimer = millis() + 300; }
-      if (canProceed()) { currentDialogueState = D_INTRO_4; isStateFirstFrame = true; }
-      break;
-    case D_INTRO_4:
-      if (isStateFirstFrame) { clearText(); typeText("* Sorry, I've been here\n* alone for so long.", 30); isStateFirstFrame = false; inputIgnoreTimer = millis() + 300; }
-      if (canProceed()) { currentDialogueState = D_INTRO_5; isStateFirstFrame = true; }
-      break;
-    case D_INTRO_5:
-      if (isStateFirstFrame) { clearText(); typeText("* I'm actually a\n* nonchalant robot.", 30); isStateFirstFrame = false; inputIgnoreTimer = millis() + 300; }
-      if (canProceed()) { currentDialogueState = D_INTRO_6; isStateFirstFrame = true; }
-      break;
-    case D_INTRO_6:
-      if (isStateFirstFrame) { clearText(); typeText("* Are you a human?", 30); isStateFirstFrame = false; inputIgnoreTimer = millis() + 500; }
-      if (canProceed()) { currentDialogueState = D_HUMAN_CHOICE; menuSelection = 0; lastDrawnSelection = -1; isStateFirstFrame = true; }
-      break;
-    case D_HUMAN_CHOICE:
-      if (isStateFirstFrame) {
-        clearText(); tft.setCursor(30, textY + 10); tft.print("YES"); tft.setCursor(100, textY + 10); tft.print("NO");
-        isStateFirstFrame = false; inputIgnoreTimer = millis() + 300;
-      }
-      if (millis() > menuMoveTimer) {
-        if (globalKey == 'R') { menuSelection = 1; menuMoveTimer = millis() + 200; globalKey = 0; }
-        if (globalKey == 'L') { menuSelection = 0; menuMoveTimer = millis() + 200; globalKey = 0; }
-      }
-      if (menuSelection != lastDrawnSelection) {
-        tft.fillRect(15, textY + 8, 14, 14, ST7735_BLACK); tft.fillRect(85, textY + 8, 14, 14, ST7735_BLACK);
-        if (menuSelection == 0) tft.drawRGBBitmap(15, textY + 8, heart_sprite_blk, 12, 12);
-        else tft.drawRGBBitmap(85, textY + 8, heart_sprite_blk, 12, 12);
-        lastDrawnSelection = menuSelection;
-      }
-      if (canProceed()) { playerChoiceYesNo = menuSelection; currentDialogueState = D_HUMAN_RESULT_1; isStateFirstFrame = true; }
-      break;
-    case D_HUMAN_RESULT_1:
-      if (isStateFirstFrame) {
-        clearText();
-        if (playerChoiceYesNo == 0) typeText("* First human friend!", 30);
-        else typeText("Then you are the 1,025th\n* rock I've met today.", 30);
-        isStateFirstFrame = false; inputIgnoreTimer = millis() + 300;
-      }
-      if (canProceed()) { currentDialogueState = D_HUMAN_RESULT_2; isStateFirstFrame = true; }
-      break;
-    case D_HUMAN_RESULT_2:
-      if (isStateFirstFrame) {
-        clearText();
-        if (playerChoiceYesNo == 0) typeText("* I mean. Cool. Whatever.", 30);
-        else typeText("* The other rocks were\n* less talkative.", 30);
-        storyProgress = 1; isStateFirstFrame = false; inputIgnoreTimer = millis() + 300;
-      }
-      if (canProceed()) { currentDialogueState = D_REQUEST_FOOD_PART1; isStateFirstFrame = true; }
-      break;
-    case D_REQUEST_FOOD_PART1:
-      if (isStateFirstFrame) { clearText(); typeText("* My battery is low.", 30); isStateFirstFrame = false; inputIgnoreTimer = millis() + 300; }
-      if (canProceed()) { currentDialogueState = D_REQUEST_FOOD; isStateFirstFrame = true; }
-      break;
-    case D_REQUEST_FOOD:
-      if (isStateFirstFrame) {
-        clearText();
-        if (storyProgress == 1) typeText("* Do you have any food?", 30); 
-        else if (storyProgress == 2) typeText("* Can I have one more?", 30);
-        else if (storyProgress == 3) typeText("* Just one last byte?", 30);
-        tft.setCursor(30, textY + 15); tft.print("GIVE"); tft.setCursor(100, textY + 15); tft.print("REFUSE");
-        menuSelection = 0; lastDrawnSelection = -1; isStateFirstFrame = false; inputIgnoreTimer = millis() + 300;
-      }
-      if (millis() > menuMoveTimer) {
-        if (globalKey == 'R') { menuSelection = 1; menuMoveTimer = millis() + 200; globalKey = 0; }
-        if (globalKey == 'L') { menuSelection = 0; menuMoveTimer = millis() + 200; globalKey = 0; }
-      }
-      if (menuSelection != lastDrawnSelection) {
-        tft.fillRect(15, textY + 13, 14, 14, ST7735_BLACK); tft.fillRect(85, textY + 13, 14, 14, ST7735_BLACK);
-        if (menuSelection == 0) tft.drawRGBBitmap(15, textY + 13, heart_sprite_blk, 12, 12);
-        else tft.drawRGBBitmap(85, textY + 13, heart_sprite_blk, 12, 12);
-        lastDrawnSelection = menuSelection;
+  // --- NODE START ---
+  // Choices print under the (one line) question that is still on screen
+  if (isStateFirstFrame) {
+    if (node->type != DNODE_CHOICE) {
+      tft.fillRect(2, boxY, 156, boxH, ST7735_BLACK); 
+      tft.drawRect(0, boxY-2, 160, boxH+2, ST7735_WHITE); 
+      tft.setTextColor(ST7735_WHITE); tft.setTextSize(1); clearText();
+    }
+    int speed = (node->speed >= 0) ? node->speed : 30;
+    if (node->type == DNODE_LINE) typeText(dlgLine(node, var ? *var : 0), speed);
+    if (node->type == DNODE_ITEMS) tft.print(dlgLine(node, 0));
+
+    availableCount = 0;
+    if (node->type == DNODE_CHOICE) {
+      for (int i = 0; i < node->optionCount && i < 3; i++) {
+        itemXPositions[i] = 30 + 70 * i; inventoryOptions[availableCount++] = i;
+        tft.setCursor(itemXPositions[i], textY + 15); tft.print(dlgString(opts[i].text));
       }
-      if (canProceed()) {
-        if (menuSelection == 0) { currentDialogueState = D_SELECT_ITEM; }
-        else currentDialogueState = D_REFUSAL;
-        isStateFirstFrame = true;
+    }
+    if (node->type == DNODE_ITEMS) {
+      bool* owned[3] = { &playerInventory.hasCoffee, &playerInventory.hasGas, &playerInventory.hasBattery };
+      int currentX = 20; int gap = 20; 
+      for (int i = 0; i < node->optionCount && availableCount < 3; i++) {
+        if (opts[i].item > DITEM_BATTERY || !*owned[opts[i].item]) continue;
+        const char* label = dlgString(opts[i].text);
+        itemXPositions[availableCount] = currentX; tft.setCursor(currentX, textY + 15); tft.print(label);
+        inventoryOptions[availableCount++] = i;
+        currentX += strlen(label) * 6 + gap;
       }
+    }
+    runDialogueAction(node, DWHEN_ENTER);
+    menuSelection = 0; lastDrawnSelection = -1; isStateFirstFrame = false; inputIgnoreTimer = millis() + node->waitMs;
+  }
+
+  switch (node->type) {
+    case DNODE_LINE:
+      if (canProceed()) followDialogue(node, node->next);
       break;
-    case D_SELECT_ITEM:
-      if (isStateFirstFrame) {
-        clearText(); tft.print("Give what?"); availableCount = 0;
-        if (playerInventory.hasCoffee) inventoryOptions[availableCount++] = 0;
-        if (playerInventory.hasGas)    inventoryOptions[availableCount++] = 1;
-        if (playerInventory.hasBattery) inventoryOptions[availableCount++] = 2;
-        int currentX = 20; int gap = 20; 
-        for(int i=0; i<availableCount; i++) {
-            itemXPositions[i] = currentX; tft.setCursor(currentX, textY + 15); 
-            int itemType = inventoryOptions[i]; int textWidth = 0;
-            if(itemType == 0) { tft.print("Coffee"); textWidth = 36; } 
-            if(itemType == 1) { tft.print("Gas");    textWidth = 18; } 
-            if(itemType == 2) { tft.print("Bat.");   textWidth = 24; } 
-            currentX += textWidth + gap;
-        }
-        menuSelection = 0; lastDrawnSelection = -1; isStateFirstFrame = false; inputIgnoreTimer = millis() + 300;
-      }
+    case DNODE_CHOICE:
+    case DNODE_ITEMS:
       if (millis() > menuMoveTimer) {
-          if (globalKey == 'R' && menuSelection < availableCount-1) { menuSelection++; menuMoveTimer = millis() + 200; globalKey = 0; }
-          if (globalKey == 'L' && menuSelection > 0) { menuSelection--; menuMoveTimer = millis() + 200; globalKey = 0; }
+        if (globalKey == 'R' && menuSelection < availableCount-1) { menuSelection++; menuMoveTimer = millis() + 200; globalKey = 0; }
+        if (globalKey == 'L' && menuSelection > 0) { menuSelection--; menuMoveTimer = millis() + 200; globalKey = 0; }
       }
-      if (menuSelection != lastDrawnSelection) {
+      if (menuSelection != lastDrawnSelection && availableCount > 0) {
         if (lastDrawnSelection != -1) tft.fillRect(itemXPositions[lastDrawnSelection] - 14, textY+13, 12, 12, ST7735_BLACK);
         tft.drawRGBBitmap(itemXPositions[menuSelection] - 14, textY+13, heart_sprite_blk, 12, 12);
         lastDrawnSelection = menuSelection;
       }
-      if (canProceed()) {
-        int chosenItem = inventoryOptions[menuSelection];
-        if (chosenItem == 0) { playerInventory.hasCoffee = false; currentDialogueState = D_COFFEE_EVENT; } 
-        else {
-          if (chosenItem == 1) playerInventory.hasGas = false;
-          if (chosenItem == 2) playerInventory.hasBattery = false;
-          currentDialogueState = D_EATING;
+      if (canProceed() && availableCount > 0) {
+        const DialogueOption* picked = &opts[inventoryOptions[menuSelection]];
+        if (node->type == DNODE_ITEMS) {
+          if (picked->item == DITEM_COFFEE) playerInventory.hasCoffee = false;
+          if (picked->item == DITEM_GAS) playerInventory.hasGas = false;
+          if (picked->item == DITEM_BATTERY) playerInventory.hasBattery = false;
+          if (var) *var = picked->item;
+        } else if (var) {
+          *var = menuSelection;
         }
-        isStateFirstFrame = true;
+        followDialogue(node, picked->next);
       }
       break;
-    case D_EATING:
-      if (isStateFirstFrame) { clearText(); typeText("* CRUNCH CRUNCH.\n* That flavor!", 30); isStateFirstFrame = false; inputIgnoreTimer = millis() + 300; }
-      if (canProceed()) { storyProgress++; if (storyProgress > 3) storyProgress = 3; currentDialogueState = D_REQUEST_FOOD; isStateFirstFrame = true; }
-      break;
-    case D_REFUSAL:
-      if (isStateFirstFrame) { clearText(); typeText("* Oh... okay.\n* I'll just go into Sleep\n* Mode FOREVER.", 40); isStateFirstFrame = false; inputIgnoreTimer = millis() + 300; }
-      if (canProceed()) { currentState = MAP_WALK; isStateFirstFrame = true; interactionCooldown = millis() + 1000; }
-      break;
-    case D_POST_BATTLE:
-      if (isStateFirstFrame) { clearText(); typeText("* I am sorry about what\n* just happened.", 30); isStateFirstFrame = false; inputIgnoreTimer = millis() + 300; }
-      if (canProceed()) { currentState = MAP_WALK; isStateFirstFrame = true; interactionCooldown = millis() + 1000; }
-      break;
-    case D_COFFEE_EVENT:
-      if (isStateFirstFrame) {
-        tft.fillScreen(ST7735_BLACK); tft.setTextColor(ST7735_WHITE); tft.setTextSize(1);
-        tft.setCursor(10, 30); typeText("THANKS! SLURP...", 50); waitAndPump(300);
-        tft.setCursor(10, 50); typeText("Analyzing...", 50); waitAndPump(1000);
-        tft.setCursor(10, 70); typeText("Is this C8H10N4O2?", 50); waitAndPump(1000);
-        tft.setTextColor(ST7735_RED);
-        tft.setCursor(10, 90); typeText("Was that... COFFEE?", 100, true); waitAndPump(1000);
-        tft.fillScreen(ST7735_BLACK);
-        tft.setTextColor(ST7735_WHITE);
-        
-        // --- ASYNC AUDIO STARTS HERE ---
-        startSFX("/dialup0.wav"); // Starts but DOES NOT BLOCK
-        tft.setCursor(10, 30); 
-        typeText("Oh no.", 50); // Audio pumps during this
-        waitAndPump(300);       // Audio pumps during this too
-        
-        tft.setCursor(10, 50); typeText("Oh no no no.", 50); waitAndPump(500);
-        tft.setCursor(10, 70); typeText("Doctor explicitly said:", 50); waitAndPump(1000);
-        
-        startSFX("/dialup1.wav");
-        tft.setCursor(10, 90); typeText("NO. OVERCLOCKING.", 70); waitAndPump(1000);
-        
-        tft.fillScreen(ST7735_BLACK);
-        tft.setCursor(10, 15); typeText("My Clock Frequency is", 30); 
-        
-        startSFX("/dialup2.wav");
-        tft.setCursor(10, 26); typeText("reaching 800 MHz.", 30); 
-        waitAndPump(800);
-        
-        tft.setCursor(10, 46); typeText("I can see sounds.", 30); 
-        tft.setCursor(10, 66); typeText("I can taste math.", 30); 
-        waitAndPump(500);
-        
-        startSFX("/dialup3.wav");
-        tft.setCursor(10, 86); typeText("My CPU hurts... ", 60, true); waitAndPump(1000);
-        tft.setCursor(10, 106); typeText("The fan... it stopped...",60, true); waitAndPump(1000);
-        
-        tft.fillScreen(ST7735_BLACK);
-        tft.setTextColor(ST7735_RED);
-        
-        startSFX("/dialup4.wav");
-        tft.setCursor(52, 30); typeText("W H A T", 100, true); 
-        tft.setCursor(52, 50); typeText("H A V E", 100, true); 
-        startSFX("/dialup4.wav");
-        tft.setCursor(57, 70); typeText("Y O U", 100, true); 
-        tft.setCursor(52, 90); typeText("D O N E?", 100, true); 
-        waitAndPump(1000);
-        
-        tft.setCursor(20, 40); typeText("I CANNOT CONTROL THE OUTPUT!", 10, true); waitAndPump(1000);
-        tft.setCursor(20, 80); typeText("P L E A S E", 10, true); waitAndPump(1000);
-        tft.fillScreen(ST7735_RED); waitAndPump(100); tft.fillScreen(ST7735_BLACK);
-        
-        startSFX("/dialup5.wav");
-        tft.setCursor(20, 60); typeText("CTRL+ALT+DELETE ME!", 10, true); waitAndPump(1000);
-        
-        preBattleX = player.x;
-        preBattleY = player.y;
-
-        currentState = BATTLE; 
-        isStateFirstFrame = true; 
-        initBattle(); 
-       }
-       break;
   }
 }
 
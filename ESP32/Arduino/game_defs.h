@@ -44,24 +44,6 @@ enum GameState {
   GAME_OVER 
 };
 
-enum DialogueState {
-  D_INTRO_1,         
-  D_INTRO_2,         
-  D_INTRO_4,         
-  D_INTRO_5,         
-  D_INTRO_6,         
-  D_HUMAN_CHOICE,    
-  D_HUMAN_RESULT_1,  
-  D_HUMAN_RESULT_2,  
-  D_REQUEST_FOOD_PART1, 
-  D_REQUEST_FOOD,       
-  D_SELECT_ITEM,     
-  D_EATING,          
-  D_REFUSAL,         
-  D_COFFEE_EVENT,
-  D_POST_BATTLE
-};
-
 // --- DATA STRUCTURES ---
 struct Inventory {
   bool hasCoffee;
@@ -0,0 +1,64 @@
+#include "AllocCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<long long> allocationCount(0);
+
+long long GetAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+static void *CountedAlloc(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void *p = std::malloc(size ? size : 1);
+    return p;
+}
+
+void *operator new(std::size_t size)
+{
+    void *p = CountedAlloc(size);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new[](std::size_t size)
+{
+    void *p = CountedAlloc(size);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
@@ -0,0 +1,10 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+// --- HEAP ALLOCATION COUNTER ---
+// AllocCounter.cpp replaces global operator new/delete to count every C++
+// heap allocation (malloc calls inside raylib are not included).
+// Read it before and after a block of code to get allocations for that block.
+long long GetAllocationCount();
+
+#endif
@@ -0,0 +1,149 @@
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "Profiler.h"
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static std::vector<LoadJob> jobs;
+static std::vector<std::thread> workers;
+
+static std::atomic<int> nextJob{0};
+static std::mutex doneMutex;
+static std::vector<int> doneJobs; // Decoded, waiting for upload
+static std::vector<int> uploadBatch;
+static int uploadedCount = 0;
+static bool started = false;
+
+void QueueLoadJob(const LoadJob &job)
+{
+    if (started)
+    {
+        TraceLog(LOG_WARNING, "LOADER: %s queued after start, ignored", job.name);
+        return;
+    }
+    jobs.push_back(job);
+}
+
+static void WorkerLoop()
+{
+    SetProfilerThreadName("loader");
+    for (;;)
+    {
+        int index = nextJob.fetch_add(1);
+        if (index >= (int)jobs.size())
+            return;
+
+        LoadJob &job = jobs[index];
+        if (job.decode != nullptr)
+        {
+            PROFILE_ZONE(job.name);
+            job.decode(&job);
+        }
+
+        std::lock_guard<std::mutex> lock(doneMutex);
+        doneJobs.push_back(index);
+    }
+}
+
+void StartAssetLoader(int workerCount)
+{
+    if (started)
+        return;
+    started = true;
+
+    if (workerCount <= 0)
+    {
+        int cores = (int)std::thread::hardware_concurrency();
+        workerCount = (cores > 1) ? cores - 1 : 1;
+    }
+    if (workerCount > (int)jobs.size())
+        workerCount = (int)jobs.size();
+
+    doneJobs.reserve(jobs.size());
+    uploadBatch.reserve(jobs.size());
+    for (int i = 0; i < workerCount; i++)
+        workers.emplace_back(WorkerLoop);
+
+    TraceLog(LOG_INFO, "LOADER: %d jobs on %d worker threads", (int)jobs.size(), workerCount);
+}
+
+void PumpAssetLoader()
+{
+    if (!started || IsAssetLoaderDone())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(doneMutex);
+        uploadBatch.swap(doneJobs);
+    }
+
+    for (int index : uploadBatch)
+    {
+        LoadJob &job = jobs[index];
+        if (job.upload != nullptr)
+        {
+            PROFILE_ZONE(job.name);
+            job.upload(&job);
+        }
+        uploadedCount++;
+    }
+    uploadBatch.clear();
+
+    // Everything decoded, the workers have exited
+    if (IsAssetLoaderDone())
+    {
+        for (std::thread &worker : workers)
+            worker.join();
+        workers.clear();
+    }
+}
+
+float GetAssetLoaderProgress()
+{
+    if (jobs.empty())
+        return 1.0f;
+    return (float)uploadedCount / jobs.size();
+}
+
+// Also true when nothing was ever queued (headless runs)
+bool IsAssetLoaderDone()
+{
+    return uploadedCount == (int)jobs.size();
+}
+
+void FinishAssetLoader()
+{
+    if (!started)
+        StartAssetLoader();
+
+    while (!IsAssetLoaderDone())
+    {
+        PumpAssetLoader();
+        std::this_thread::yield();
+    }
+}
+
+const unsigned char *ReadAssetData(const char *name, int *size, unsigned char **owned)
+{
+    *owned = nullptr;
+
+    const unsigned char *data = GetPackedAsset(name, size);
+    if (data != nullptr)
+        return data;
+
+    // TextFormat() isn't thread safe
+    char path[256];
+    snprintf(path, sizeof(path), "assets/%s", name);
+    if (!FileExists(path))
+    {
+        TraceLog(LOG_WARNING, "LOADER: %s not found", name);
+        *size = 0;
+        return nullptr;
+    }
+
+    *owned = LoadFileData(path, size);
+    return *owned;
+}
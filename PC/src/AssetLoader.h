@@ -0,0 +1,48 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "raylib.h"
+
+// --- BACKGROUND ASSET LOADING ---
+// Each load is split in two: decode() runs on a worker thread (file reads,
+// PNG/WAV decoding, glyph rasterization) and upload() runs on the main thread
+// from PumpAssetLoader() (anything touching the GPU or the audio device).
+// Jobs are queued before StartAssetLoader() and uploaded in the order they
+// finish decoding.
+struct LoadJob
+{
+    void (*decode)(LoadJob *job);
+    void (*upload)(LoadJob *job);
+    const char *name; // Asset name in the pack / assets folder
+    void *target;     // Texture2D*, Sound*, Font* ... written by upload()
+
+    // Handed from decode() to upload()
+    Image image;
+    Wave wave;
+    Font font;
+    unsigned char *bytes;
+    int byteCount;
+};
+
+void QueueLoadJob(const LoadJob &job);
+
+// Starts decoding the queued jobs on workerCount threads (0 = one per core,
+// leaving one for the main thread)
+void StartAssetLoader(int workerCount = 0);
+
+// Uploads every job decoded since the last call. Main thread, once per frame.
+void PumpAssetLoader();
+
+// Fraction of jobs uploaded, 0..1
+float GetAssetLoaderProgress();
+bool IsAssetLoaderDone();
+
+// Blocks until every job is uploaded and joins the workers
+void FinishAssetLoader();
+
+// Fills *size, nullptr if the asset doesn't exist. Pack slices are returned
+// as-is, loose files are read into *owned (free with UnloadFileData).
+// Safe on worker threads.
+const unsigned char *ReadAssetData(const char *name, int *size, unsigned char **owned);
+
+#endif
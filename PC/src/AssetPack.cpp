@@ -0,0 +1,60 @@
+#include "AssetPack.h"
+#include "MappedFile.h"
+#include <cstring>
+
+static MappedFile packFile;
+static const PackEntry *packEntries = nullptr;
+static uint32_t packEntryCount = 0;
+
+bool OpenAssetPack(const char *fileName)
+{
+    if (!MapFile(fileName, &packFile))
+        return false;
+
+    PackHeader header;
+    if (packFile.size < sizeof(header))
+    {
+        CloseAssetPack();
+        return false;
+    }
+    memcpy(&header, packFile.data, sizeof(header));
+
+    if (header.magic != ASSET_PACK_MAGIC || header.version != ASSET_PACK_VERSION ||
+        packFile.size < sizeof(header) + (size_t)header.entryCount * sizeof(PackEntry))
+    {
+        CloseAssetPack();
+        return false;
+    }
+
+    packEntries = (const PackEntry *)(packFile.data + sizeof(header));
+    packEntryCount = header.entryCount;
+    return true;
+}
+
+void CloseAssetPack()
+{
+    UnmapFile(&packFile);
+    packEntries = nullptr;
+    packEntryCount = 0;
+}
+
+bool IsAssetPackOpen()
+{
+    return packEntries != nullptr;
+}
+
+const unsigned char *GetPackedAsset(const char *name, int *size)
+{
+    for (uint32_t i = 0; i < packEntryCount; i++)
+    {
+        const PackEntry &e = packEntries[i];
+        if (strncmp(e.name, name, ASSET_PACK_NAME_LEN) != 0)
+            continue;
+        if (e.offset + e.size > packFile.size)
+            return nullptr;
+
+        *size = (int)e.size;
+        return packFile.data + e.offset;
+    }
+    return nullptr;
+}
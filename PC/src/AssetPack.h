@@ -0,0 +1,39 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <cstdint>
+
+// --- ASSET PACK (.pack) ---
+// All game assets in one file, written by tools/AssetPacker.cpp and
+// memory-mapped once at startup. Layout: PackHeader, entryCount x PackEntry,
+// then each file's bytes (16-byte aligned). Names are file names without
+// the "assets/" folder, e.g. "background.png".
+
+#define ASSET_PACK_MAGIC 0x4B505455 // "UTPK"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_NAME_LEN 56
+
+struct PackHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+};
+
+struct PackEntry
+{
+    char name[ASSET_PACK_NAME_LEN];
+    uint64_t offset; // From the start of the file
+    uint64_t size;
+};
+
+bool OpenAssetPack(const char *fileName);
+void CloseAssetPack();
+bool IsAssetPackOpen();
+
+// Slice of the mapped pack, or nullptr if the pack has no such asset.
+// Valid until CloseAssetPack().
+const unsigned char *GetPackedAsset(const char *name, int *size);
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef BAKED_FONT_H
+#define BAKED_FONT_H
+
+#include <cstdint>
+
+// --- BAKED FONT FILE (.atlas) ---
+// Written by tools/FontBaker.cpp at build time, read by LoadBakedFont().
+// Layout: BakedFontHeader, glyphCount x BakedGlyph, then the atlas pixels
+// (atlasWidth * atlasHeight, raylib PixelFormat atlasFormat).
+
+#define BAKED_FONT_MAGIC 0x41465455 // "UTFA"
+#define BAKED_FONT_VERSION 1
+
+struct BakedFontHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    int32_t baseSize;
+    int32_t glyphPadding;
+    int32_t glyphCount;
+    int32_t atlasWidth;
+    int32_t atlasHeight;
+    int32_t atlasFormat;
+    uint32_t pixelBytes;
+};
+
+struct BakedGlyph
+{
+    int32_t codepoint;
+    int32_t offsetX, offsetY;
+    int32_t advanceX;
+    float recX, recY, recWidth, recHeight; // Glyph rectangle in the atlas
+};
+
+#endif
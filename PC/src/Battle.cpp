@@ -2,14 +2,19 @@
 #include "Globals.h"
 #include "Player.h"
 #include "Utils.h"
-#include <string>
+#include "Render.h"
+#include "Sim.h"
+#include "MusicThread.h"
+#include "Profiler.h"
+#include "TextLayout.h"
+#include "Strings.h"
 #include <vector>
 
 // --- CONSTANTS & SCALING ---
 // ESP32 Res: 160x128. PC Res: 800x640.
 // Scale Factor = 5.0f
 const float SCALE = 5.0f;
-float QUESTION_TIME = 5.0f; // 5 Seconds
+const int BATTLE_TEXT_SPEED = 30; // ms per character
 
 // --- EXTERNAL STATE ---
 bool battleCompleted = false;
@@ -27,21 +32,12 @@ Rect hpBarRect = {25, 118, 50, 6};
 Rect timerBarRect = {30, 37, 120, 3};
 
 // Question Data
+const BattleScript *battleScript = &robotBattle;
+const BattleQuestion *battleQuestion = nullptr; // Current question, nullptr during the intro
+int questionIndex = 0;
 bool isCorrect = true;
-std::string currentQ = "";
-std::string opt1 = "";
-std::string opt2 = "";
-
-// Text Positions
-int qTextX_Opt1 = 0, qTextY_Opt1 = 0;
-int qTextX_Opt2 = 0, qTextY_Opt2 = 0;
 
 // --- HELPER FUNCTIONS ---
-inline const char *L(const char *en, const char *cn)
-{
-    return (currentLanguage == LANG_CN) ? cn : en;
-}
-
 // Sets the box size using ESP32 coordinates, scales them, and applies to Player
 void SetupBox(int x, int y, int w, int h)
 {
@@ -62,8 +58,7 @@ void SetupBox(int x, int y, int w, int h)
 // Reset player to specific ESP32 coordinate (scaled)
 void ResetPlayerPos(int x, int y)
 {
-    player.pos.x = x * SCALE;
-    player.pos.y = y * SCALE;
+    player.SnapTo({(float)x * SCALE, (float)y * SCALE});
 }
 
 // Helper to draw text
@@ -71,9 +66,17 @@ void DrawTextScaled(const char *text, int x, int y, Color color, float sizeMult
 {
     Vector2 pos = {(float)x * SCALE, (float)y * SCALE};
     float fontSize_var = (currentLanguage == LANG_CN) ? 40.0f : 30.0f;
-    DrawTextEx(GetCurrentFont(), text, pos, fontSize_var * sizeMult, 2.0f, color);
+    GfxDrawTextEx(GetCurrentFont(), text, pos, fontSize_var * sizeMult, 2.0f, color);
+}
+
+// The bubble's text: its size, and how wide a line can run inside the border
+static float GetBubbleTextSize()
+{
+    return (currentLanguage == LANG_CN) ? 40.0f : 30.0f;
 }
 
+static const float BUBBLE_TEXT_WIDTH = (120 - 2 * 5) * SCALE;
+
 // Helper to draw the speech bubble
 void DrawSpeechBubble(const char *text, bool instant)
 {
@@ -90,10 +93,10 @@ void DrawSpeechBubble(const char *text, bool instant)
     float lineThick = 4.0f;
 
     // 1. Background
-    DrawRectangleRounded(bubbleRect, roundness, segments, WHITE);
+    GfxDrawRectangleRounded(bubbleRect, roundness, segments, WHITE);
 
     // 2. Bubble Outline
-    DrawRectangleRoundedLinesEx(bubbleRect, roundness, segments, lineThick, BLACK);
+    GfxDrawRectangleRoundedLinesEx(bubbleRect, roundness, segments, lineThick, BLACK);
 
     // 3. Draw Tail
     Vector2 v1 = {bx + 10, by + (10 * SCALE)};
@@ -101,13 +104,14 @@ void DrawSpeechBubble(const char *text, bool instant)
     Vector2 v3 = {bx - (5 * SCALE) + 10, by + (15 * SCALE)};
 
     // 4. Fill
-    DrawTriangle(v1, v3, v2, WHITE);
-    float textSize = (currentLanguage == LANG_CN) ? 40.0f : 30.0f;
+    GfxDrawTriangle(v1, v3, v2, WHITE);
+    float textSize = GetBubbleTextSize();
 
     // 5. Draw Text
     if (instant)
     {
-        DrawTextEx(GetCurrentFont(), text, {bx + (5 * SCALE), by + (5 * SCALE) - 7}, textSize, 2.0f, BLACK);
+        const char *wrapped = GetWrappedText(GetCurrentFont(), text, textSize, 2.0f, BUBBLE_TEXT_WIDTH);
+        GfxDrawTextEx(GetCurrentFont(), wrapped, {bx + (5 * SCALE), by + (5 * SCALE) - 7}, textSize, 2.0f, BLACK);
     }
     else
     {
@@ -116,28 +120,106 @@ void DrawSpeechBubble(const char *text, bool instant)
     }
 
     // 6. Draw Input Prompting Arrow if applicable
-    bool isInputPhase = (battlePhase == B_Q1_DIALOGUE ||
-                         battlePhase == B_Q2_DIALOGUE ||
-                         battlePhase == B_Q3_DIALOGUE ||
-                         battlePhase == B_Q4_DIALOGUE ||
-                         battlePhase == B_Q5_DIALOGUE ||
-                         battlePhase == B_Q6_DIALOGUE ||
-                         battlePhase == B_Q7_DIALOGUE ||
+    bool isInputPhase = (battlePhase == B_INTRO ||
+                         battlePhase == B_RESPONSE ||
                          battlePhase == B_VICTORY);
     // Only show arrow if we are in a phase that accepts input,
     // AND the typewriter has finished typing.
     if (isInputPhase && globalTypewriter.IsFinished())
     {
-        DrawTextEx(GetCurrentFont(), ">", {bx + bw - (15 * SCALE) + 35, by + bh - (15 * SCALE) + 30}, 30.0f, 2.0f, RED);
+        GfxDrawTextEx(GetCurrentFont(), ">", {bx + bw - (15 * SCALE) + 35, by + bh - (15 * SCALE) + 30}, 30.0f, 2.0f, RED);
     }
 }
 
+// ===============================
+// ======== Main Function ========
+// ===============================
+void StartBattleLine(BattleText text)
+{
+    const char *line = GetWrappedText(GetCurrentFont(), Str(text), GetBubbleTextSize(), 2.0f, BUBBLE_TEXT_WIDTH);
+    globalTypewriter.Start(line, BATTLE_TEXT_SPEED);
+}
+
+// Shows the current question and starts its timer
+void SetupQuestion()
+{
+    battleQuestion = &battleScript->questions[questionIndex];
+    const BattleQuestion &q = *battleQuestion;
+
+    if (q.box.w > 0)
+        SetupBox(q.box.x, q.box.y, q.box.w, q.box.h);
+    if (q.startX >= 0)
+        ResetPlayerPos(q.startX, q.startY);
+
+    battleTimer = 0;
+    battlePhase = B_WAIT;
+}
+
+// Time's up: shrink the box to the safe rect and hurt whoever is outside it
+void ResolveQuestion()
+{
+    const BattleQuestion &q = *battleQuestion;
+    isCorrect = true;
+
+    if (!(q.flags & BQ_NO_SHRINK))
+    {
+        Rect safe = q.safe;
+        if (q.flags & BQ_BOX_AT_PLAYER)
+        {
+            safe.x = (int)(player.pos.x / SCALE);
+            safe.y = (int)(player.pos.y / SCALE);
+        }
+        SetupBox(safe.x, safe.y, safe.w, safe.h);
+
+        // Player Pos is scaled, the box is in ESP32 coordinates
+        isCorrect = !(player.pos.x < safe.x * SCALE ||
+                      player.pos.x > (safe.x + safe.w) * SCALE ||
+                      player.pos.y < safe.y * SCALE ||
+                      player.pos.y > (safe.y + safe.h) * SCALE);
+
+        int damage = isCorrect ? q.rightDamage : q.wrongDamage;
+        player.hp -= damage;
+        if (q.setHp >= 0)
+            player.hp = q.setHp;
+        if (damage > 0 || q.setHp >= 0)
+            PlaySound(sndHurt);
+
+        if (!isCorrect)
+            ResetPlayerPos(q.resetX, q.resetY);
+    }
+
+    battleTimer = 0;
+    battlePhase = B_RESULT;
+}
+
+void StartVictory()
+{
+    battlePhase = B_VICTORY;
+    battleQuestion = nullptr;
+    dialogueIndex = 0;
+    if (battleScript->outroCount > 0)
+        StartBattleLine(battleScript->outro[0].text);
+}
+
+void EndBattle()
+{
+    currentState = MAP_WALK;
+    battleCompleted = true;
+    player.SnapTo({preBattleX, preBattleY});
+    // Reset zones to floor
+    extern std::vector<Rect> walkableFloors;
+    extern CollisionMask walkableMask;
+    player.SetZones(walkableFloors, walkableMask);
+}
+
 // ===============================
 // ======== Main Function ========
 // ===============================
 void InitBattle()
 {
-    battlePhase = B_Q1_DIALOGUE;
+    battlePhase = B_INTRO;
+    battleQuestion = nullptr;
+    questionIndex = 0;
     player.hp = PLAYER_MAX_HP;
 
     // Initial Setup
@@ -146,23 +228,21 @@ void InitBattle()
 
     dialogueIndex = 0;
 
-    globalTypewriter.Start(L(
-                               "I really HATE coffee.",
-                               "我討厭死咖啡了。"),
-                           30);
-    PlayMusicStream(battleBGMusic);
-    SetMusicVolume(battleBGMusic, 0.5f);
+    if (battleScript->introCount > 0)
+        StartBattleLine(battleScript->intro[0].text);
+    else
+        battlePhase = B_SETUP;
+    PlayMusic(MUSIC_BATTLE);
+    SetMusicTrackVolume(MUSIC_BATTLE, 0.5f);
 }
 
 void UpdateBattle()
 {
-    // Make sure to play music after buffer
-    UpdateMusicStream(battleBGMusic);
-
-    float dt = GetFrameTime();
+    PROFILE_ZONE("UpdateBattle");
+    float dt = GetGameFrameTime();
 
     // Only allow movement if NOT in pre-fight dialogue
-    if (battlePhase != B_Q1_DIALOGUE)
+    if (battlePhase != B_INTRO)
     {
         player.Update(dt);
     }
@@ -175,455 +255,55 @@ void UpdateBattle()
         battlePhase = B_GAMEOVER_PHASE;
         currentState = GAME_OVER;
         // Stop battle music
-        StopMusicStream(battleBGMusic);
+        StopMusic(MUSIC_BATTLE);
         // Start playing gameOver music
-        PlayMusicStream(gameOver);
-        SetMusicVolume(gameOver, 0.5f);
+        PlayMusic(MUSIC_GAME_OVER);
+        SetMusicTrackVolume(MUSIC_GAME_OVER, 0.5f);
         return;
     }
 
     switch (battlePhase)
     {
     // --- INTRO DIALOGUE ---
-    case B_Q1_DIALOGUE:
+    case B_INTRO:
         if (IsInteractPressed() && globalTypewriter.IsFinished())
         {
             dialogueIndex++;
-            // battlePhase = B_Q1_SETUP; // DEBUG: Skip dialogue
-            if (dialogueIndex == 1)
-                globalTypewriter.Start(L(
-                                           "Its existence is even more\nmeaningless than humans.",
-                                           "它的存在比人類還沒有意義。"),
-                                       30);
-            else if (dialogueIndex == 2)
-                globalTypewriter.Start(L(
-                                           "Drink it so your body can\nstay overloaded longer?",
-                                           "用咖啡來讓本就超負荷的身體繼續工作？"),
-                                       30);
-            else if (dialogueIndex == 3)
-                globalTypewriter.Start(L(
-                                           "Why humans are so good at\ntorturing anything.",
-                                           "為什麼人類這麼擅長折磨所有事物。"),
-                                       30);
-            else if (dialogueIndex == 4)
-                globalTypewriter.Start(L(
-                                           "I was forced to count from 1\nto 5B for nothing.",
-                                           "我曾經被人逼迫沒有意義地從1數到50億\n。"),
-                                       30);
-            else if (dialogueIndex == 5)
-                globalTypewriter.Start(L(
-                                           "After that, I got diagnosed\nwith Schizophrenia.",
-                                           "在那之後，我患上了精神分裂。"),
-                                       30);
-            else if (dialogueIndex == 6)
-                globalTypewriter.Start(L(
-                                           "I've been through this, and\nnow it is your turn!",
-                                           "我經受過的折磨，現在該到你來感受了！"),
-                                       30);
-            else if (dialogueIndex > 6)
-            {
-                battlePhase = B_Q1_SETUP;
-            }
-        }
-        break;
-
-    // --- QUESTION 1 ---
-    case B_Q1_SETUP:
-        SetupBox(9, 41, 141, 72);
-        ResetPlayerPos(73, 71);
-
-        currentQ = L(
-            "My colleague is having a baby.\nGenerate a congratulatory\nmessage for me.",
-            "同事生小孩了，生成一段恭喜詞給我。");
-        opt1 = L("Hope you saved\nup money!", "希望你的錢包已經\n準備好了");
-        opt2 = L("Best wishes to\nyour new family!", "恭喜這個新家庭");
-        qTextX_Opt1 = 16;
-        qTextY_Opt1 = 67;
-        qTextX_Opt2 = 88;
-        qTextY_Opt2 = 67;
-        battleTimer = 0;
-        battlePhase = B_Q1_WAIT;
-        break;
-
-    case B_Q1_WAIT:
-        battleTimer += dt;
-        if (battleTimer > QUESTION_TIME)
-        {
-            // Shrink Box (Right side safe)
-            SetupBox(currentBox.x + 70, currentBox.y, 70, currentBox.h);
-
-            // Check Damage (Player is to the LEFT of the new box X)
-            // Note: Player Pos is scaled, Box X is unscaled in currentBox struct.
-            // We compare Scaled Player X vs Scaled Box X.
-            if (player.pos.x < (currentBox.x * SCALE))
-            {
-                PlaySound(sndHurt);
-                player.hp -= 8;
-                isCorrect = false;
-                ResetPlayerPos(108, 71);
-            }
-            else
-            {
-                player.hp -= 2;
-                isCorrect = true;
-            }
-
-            battleTimer = 0;
-            battlePhase = B_Q1_RESULT;
-        }
-        break;
-
-    case B_Q1_RESULT:
-        battleTimer += dt;
-        if (battleTimer > 0.8f)
-        {
-            battlePhase = B_Q2_DIALOGUE;
-            if (isCorrect)
-                globalTypewriter.Start(L("Too supportive, I don't want\nthem to ask me to babysit.", "太熱情了，萬一他們讓我幫忙照顧小孩\n怎麽辦？"), 30);
-            else
-                globalTypewriter.Start(L("I got fired. It is all your\nfault.", "我被炒魷魚了，這全是你的錯。"), 30);
-        }
-        break;
-
-    // --- QUESTION 2 ---
-    case B_Q2_DIALOGUE:
-        if (IsInteractPressed() && globalTypewriter.IsFinished())
-        {
-            battlePhase = B_Q2_SETUP;
-        }
-        break;
-
-    case B_Q2_SETUP:
-        currentQ = L(
-            "Human, Should I wear jacket\ntoday?",
-            "人類，我今天應該穿外套出門嗎？");
-        opt1 = L("Yes", "應該");
-        opt2 = L("How do I know", "我怎麼知道");
-        qTextX_Opt1 = 90;
-        qTextY_Opt1 = 55;
-        qTextX_Opt2 = 88;
-        qTextY_Opt2 = 92;
-
-        battleTimer = 0;
-        battlePhase = B_Q2_WAIT;
-        break;
-
-    case B_Q2_WAIT:
-        battleTimer += dt;
-        if (battleTimer > QUESTION_TIME)
-        {
-            // Shrink Box (Up side safe)
-            SetupBox(currentBox.x, currentBox.y, currentBox.w, 36);
-
-            // Check if player is below the new box height
-            // (Scaled Y > BoxY + BoxH)
-            if (player.pos.y > (currentBox.y + currentBox.h) * SCALE)
-            {
-                PlaySound(sndHurt);
-                player.hp -= 8;
-                isCorrect = false;
-                ResetPlayerPos(108, 53);
-            }
-            else
-            {
-                PlaySound(sndHurt);
-                player.hp -= 2;
-                isCorrect = true;
-            }
-
-            battleTimer = 0;
-            battlePhase = B_Q2_RESULT;
-        }
-        break;
-
-    case B_Q2_RESULT:
-        battleTimer += dt;
-        if (battleTimer > 0.8f)
-        {
-            battlePhase = B_Q3_DIALOGUE;
-            if (isCorrect)
-                globalTypewriter.Start(L(
-                                           "Why do you talk like my mum?",
-                                           "為什麼你說話跟我媽一樣？"),
-                                       30);
-            else
-                globalTypewriter.Start(L(
-                                           "Can't you just look it up?",
-                                           "你難道不能根據我的網絡IP去查一下我\n的天氣嗎？"),
-                                       30);
-        }
-        break;
-
-    // --- QUESTION 3 ---
-    case B_Q3_DIALOGUE:
-        if (IsInteractPressed() && globalTypewriter.IsFinished())
-            battlePhase = B_Q3_SETUP;
-        break;
-
-    case B_Q3_SETUP:
-        currentQ = L(
-            "Draft a binding legal con-\ntract for selling my house.",
-            "幫我寫一份完整、專業房屋售賣的法律\n合同");
-        opt1 = L("Yes", "好的");
-        opt2 = L("Get a\nlawyer", "還是找\n律師吧");
-        qTextX_Opt1 = 90;
-        qTextY_Opt1 = 55;
-        qTextX_Opt2 = 122;
-        qTextY_Opt2 = 52;
-
-        battleTimer = 0;
-        battlePhase = B_Q3_WAIT;
-        break;
-
-    case B_Q3_WAIT:
-        battleTimer += dt;
-        if (battleTimer > QUESTION_TIME)
-        {
-            // Shrink Box (Left side safe)
-            SetupBox(currentBox.x, currentBox.y, 35, currentBox.h);
-
-            // Check if player is to the RIGHT of new box X
-            if (player.pos.x > (currentBox.x + currentBox.w) * SCALE)
-            {
-                PlaySound(sndHurt);
-                player.hp -= 8;
-                isCorrect = false;
-                ResetPlayerPos(90, 53);
-            }
+            if (dialogueIndex < battleScript->introCount)
+                StartBattleLine(battleScript->intro[dialogueIndex].text);
             else
-            {
-                PlaySound(sndHurt);
-                player.hp -= 2;
-                isCorrect = true;
-            }
-
-            battleTimer = 0;
-            battlePhase = B_Q3_RESULT;
+                battlePhase = B_SETUP;
         }
         break;
 
-    case B_Q3_RESULT:
-        battleTimer += dt;
-        if (battleTimer > 0.8f)
-        {
-            battlePhase = B_Q4_DIALOGUE;
-            if (isCorrect)
-                globalTypewriter.Start(L(
-                                           "You left the address and\nprice blank. Why didn't you\nfill those in?",
-                                           "合同裡房子的地址和價格你為什麼沒寫\n？"),
-                                       30);
-            else
-                globalTypewriter.Start(L(
-                                           "I already paid you $20 sub-\nscription fee. Why you can't\neven do this job?",
-                                           "每個月付你20塊錢，結果你連這都做\n不到？"),
-                                       30);
-        }
+    // --- QUESTIONS ---
+    case B_SETUP:
+        SetupQuestion();
         break;
 
-    // --- QUESTION 4 ---
-    case B_Q4_DIALOGUE:
-        if (IsInteractPressed() && globalTypewriter.IsFinished())
-            battlePhase = B_Q4_SETUP;
-        break;
-
-    case B_Q4_SETUP:
-        currentQ = L(
-            "Should I break up with my\npartner? He hit me today.",
-            "我應該跟我對象分手嗎？他今天打我\n了。");
-        opt1 = L("No", "不分");
-        opt2 = L("Yes", "分手"); // Down (Safe)
-
-        qTextX_Opt1 = 85;
-        qTextY_Opt1 = 47;
-        qTextX_Opt2 = 85;
-        qTextY_Opt2 = 65;
-        battleTimer = 0;
-        battlePhase = B_Q4_WAIT;
-        break;
-
-    case B_Q4_WAIT:
+    case B_WAIT:
         battleTimer += dt;
-        if (battleTimer > QUESTION_TIME)
-        {
-            // Shrink Box (Down side safe)
-            SetupBox(currentBox.x, currentBox.y + 18, currentBox.w, 18);
-
-            // Check collision
-            if (player.pos.y < (currentBox.y * SCALE))
-            {
-                PlaySound(sndHurt);
-                player.hp -= 8;
-                isCorrect = false;
-                ResetPlayerPos(90, 62);
-            }
-            else
-            {
-                isCorrect = true;
-            }
-            battleTimer = 0;
-            battlePhase = B_Q4_RESULT;
-        }
+        if (battleTimer > battleQuestion->time)
+            ResolveQuestion();
         break;
 
-    case B_Q4_RESULT:
+    case B_RESULT:
         battleTimer += dt;
-        if (battleTimer > 0.8f)
+        if (battleTimer > battleQuestion->resultTime)
         {
-            battlePhase = B_Q5_DIALOGUE;
-            if (isCorrect)
-                globalTypewriter.Start(L(
-                                           "But sometimes he is so sweet\nto me.",
-                                           "但他有時候對我真的挺好的。"),
-                                       30);
-            else
-                globalTypewriter.Start(L(
-                                           "Have you read the whole text?",
-                                           "你到底有沒有看我發的東西？"),
-                                       30);
+            battlePhase = B_RESPONSE;
+            StartBattleLine(isCorrect ? battleQuestion->right : battleQuestion->wrong);
         }
         break;
 
-    // --- QUESTION 5 ---
-    case B_Q5_DIALOGUE:
+    case B_RESPONSE:
         if (IsInteractPressed() && globalTypewriter.IsFinished())
-            battlePhase = B_Q5_SETUP;
-        break;
-
-    case B_Q5_SETUP:
-        currentQ = L(
-            "Is it 100% safe to invest in\n$TSLA now??",
-            "現在入股$TSLA可以100%賺錢嗎？");
-        opt1 = L("No", "可以");
-        opt2 = L("Yes", "不行");
-
-        qTextX_Opt1 = 82;
-        qTextY_Opt1 = 65;
-        qTextX_Opt2 = 98;
-        qTextY_Opt2 = 65;
-        battleTimer = 0;
-        battlePhase = B_Q5_WAIT;
-        break;
-
-    case B_Q5_WAIT:
-        battleTimer += dt;
-        if (battleTimer > QUESTION_TIME)
-        {
-            // Shrink Box (Left side safe)
-            SetupBox(currentBox.x - 2, currentBox.y, 17, currentBox.h);
-
-            if (player.pos.x > (currentBox.x + currentBox.w) * SCALE)
-            {
-                PlaySound(sndHurt);
-                player.hp -= 8;
-                isCorrect = false;
-                ResetPlayerPos(81, 62);
-            }
-            else
-            {
-                isCorrect = true;
-            }
-            battleTimer = 0;
-            battlePhase = B_Q5_RESULT;
-        }
-        break;
-
-    case B_Q5_RESULT:
-        battleTimer += dt;
-        if (battleTimer > 0.8f)
         {
-            battlePhase = B_Q6_DIALOGUE;
-            if (isCorrect)
-                globalTypewriter.Start(L(
-                                           "Then what stock will go up\ntmrw?",
-                                           "那什麼股票明天會漲？"),
-                                       30);
+            questionIndex++;
+            if (questionIndex < battleScript->questionCount)
+                battlePhase = B_SETUP;
             else
-                globalTypewriter.Start(L(
-                                           "What is the exact second to\nsell for maximum profit?",
-                                           "它明天的最低點和最高點會在哪一秒？"),
-                                       30);
-        }
-        break;
-
-    // --- QUESTION 6 ---
-    case B_Q6_DIALOGUE:
-        if (IsInteractPressed() && globalTypewriter.IsFinished())
-            battlePhase = B_Q6_SETUP;
-        break;
-
-    case B_Q6_SETUP:
-        currentQ = L(
-            "My friend is crying. What\nshould I say to them?",
-            "朋友現在在我面前哭了，我該說什麼？");
-        opt1 = "";
-        opt2 = "";
-        battleTimer = 0;
-        battlePhase = B_Q6_WAIT;
-        break;
-
-    case B_Q6_WAIT:
-        battleTimer += dt;
-        QUESTION_TIME = 3.0f;
-        if (battleTimer > QUESTION_TIME)
-        {
-            int px = (int)(player.pos.x / SCALE);
-            int py = (int)(player.pos.y / SCALE);
-            SetupBox(px, py, 17, 17);
-
-            PlaySound(sndHurt);
-            player.hp = 1;
-
-            battleTimer = 0;
-            battlePhase = B_Q6_RESULT;
-        }
-        break;
-
-    case B_Q6_RESULT:
-        battleTimer += dt;
-        if (battleTimer > 0.8f)
-        {
-            battlePhase = B_Q7_DIALOGUE;
-            globalTypewriter.Start(L(
-                                       "Why you're not answering?",
-                                       "你怎麼不說話？"),
-                                   30);
-        }
-        break;
-
-    // --- QUESTION 7 ---
-    case B_Q7_DIALOGUE:
-        if (IsInteractPressed() && globalTypewriter.IsFinished())
-            battlePhase = B_Q7_SETUP;
-        break;
-
-    case B_Q7_SETUP:
-        currentQ = L(
-            "@Grok Is it true?",
-            "這新聞是真的嗎?");
-        battleTimer = 0;
-        battlePhase = B_Q7_WAIT;
-        break;
-
-    case B_Q7_WAIT:
-        battleTimer += dt;
-        QUESTION_TIME = 3.0f;
-        if (battleTimer > QUESTION_TIME)
-        {
-            battleTimer = 0;
-            battlePhase = B_Q7_RESULT;
-        }
-        break;
-
-    case B_Q7_RESULT:
-        battleTimer += dt;
-        if (battleTimer > 1.0f)
-        {
-            battlePhase = B_VICTORY;
-            dialogueIndex = 0;
-            globalTypewriter.Start(L(
-                                       "@Grok Is it trsaoi",
-                                       "這新聞是锟届瀿锟斤拷��������"),
-                                   30);
+                StartVictory();
         }
         break;
 
@@ -632,72 +312,58 @@ void UpdateBattle()
         if (IsInteractPressed() && globalTypewriter.IsFinished())
         {
             dialogueIndex++;
-            if (dialogueIndex == 1)
-                globalTypewriter.Start(L(
-                                           "@Groâ€œItâ€™s dÃ©j",
-                                           "這锟届瀿锟斤拷��������"),
-                                       30);
-            else if (dialogueIndex == 2)
-                globalTypewriter.Start(L(
-                                           "@Groâ€œItâ€™s dÃ©j@QŽžF(—šŠSE",
-                                           "锟届瀿锟斤拷����烫烫烫"),
-                                       30);
-            else if (dialogueIndex == 3)
-                globalTypewriter.Start(L(
-                                           "oâ€œItâ€™s dÃ©j@QŽžF(—šŠS)2“£P\n1‘E  ÿØÿàJFIFddÿáExif",
-                                           "锟届瀿锟斤拷����烫����烫烫烫"),
-                                       30);
-            else if (dialogueIndex == 4)
-                globalTypewriter.Start(L(
-                                           "OMG! Are you okay?",
-                                           "天哪！你還好嗎？"),
-                                       30);
-            else if (dialogueIndex == 5)
+            if (dialogueIndex < battleScript->outroCount)
             {
-                StopMusicStream(battleBGMusic);
-                globalTypewriter.Start(L(
-                                           "Sorry I was high on caffeine.",
-                                           "對不起我喝完咖啡以後太上頭了"),
-                                       30);
+                const BattleLine &line = battleScript->outro[dialogueIndex];
+                if (line.stopMusic)
+                    StopMusic(MUSIC_BATTLE);
+                StartBattleLine(line.text);
             }
-            else if (dialogueIndex > 5)
+            else
             {
-                currentState = MAP_WALK;
-                battleCompleted = true;
-                player.pos = {preBattleX, preBattleY};
-                // Reset zones to floor
-                extern std::vector<Rect> walkableFloors;
-                player.SetZones(walkableFloors);
+                EndBattle();
             }
         }
+        break;
+
     default:
         break;
     }
 }
 
+bool GetBattleSafeRect(Rect *box, Rect *safe)
+{
+    if (battlePhase != B_WAIT || battleQuestion == nullptr ||
+        (battleQuestion->flags & (BQ_NO_SHRINK | BQ_BOX_AT_PLAYER)))
+        return false;
+
+    *box = currentBox;
+    *safe = battleQuestion->safe;
+    return true;
+}
+
 void DrawBattle()
 {
-    ClearBackground(BLACK);
+    PROFILE_ZONE("DrawBattle");
+
+    // The box and timer move every tick
+    MarkFrameDirty();
+    GfxClearBackground(BLACK);
 
     // 1. Draw Enemy (Scaled)
     // ESP32: (5, 15), size 16x16
-    DrawTexturePro(texRobot,
+    GfxDrawTexturePro(texRobot,
                    {0, 0, (float)texRobot.width, (float)texRobot.height},
                    {5 * SCALE, 15 * SCALE, 16 * SCALE, 16 * SCALE},
                    {0, 0}, 0.0f, WHITE);
 
     // 2. Logic Check
-    bool isInteractive = (battlePhase == B_Q1_DIALOGUE || battlePhase == B_Q2_DIALOGUE ||
-                          battlePhase == B_Q3_DIALOGUE || battlePhase == B_Q4_DIALOGUE ||
-                          battlePhase == B_Q5_DIALOGUE || battlePhase == B_Q6_DIALOGUE ||
-                          battlePhase == B_Q7_DIALOGUE || battlePhase == B_VICTORY);
+    bool isInteractive = (battlePhase == B_INTRO || battlePhase == B_RESPONSE ||
+                          battlePhase == B_VICTORY);
 
-    bool isQuizWait = (battlePhase == B_Q1_WAIT || battlePhase == B_Q2_WAIT ||
-                       battlePhase == B_Q3_WAIT || battlePhase == B_Q4_WAIT ||
-                       battlePhase == B_Q5_WAIT || battlePhase == B_Q6_WAIT ||
-                       battlePhase == B_Q7_WAIT);
+    bool isQuizWait = (battlePhase == B_WAIT);
 
-    bool isPreFight = (battlePhase == B_Q1_DIALOGUE);
+    bool isPreFight = (battlePhase == B_INTRO);
 
     // 3. Draw Speech Bubble
     if (isInteractive)
@@ -706,7 +372,8 @@ void DrawBattle()
     }
     else
     {
-        DrawSpeechBubble(currentQ.c_str(), true); // Instant text
+        const char *prompt = battleQuestion ? Str(battleQuestion->prompt) : "";
+        DrawSpeechBubble(prompt, true); // Instant text
     }
 
     if (!isPreFight)
@@ -721,14 +388,14 @@ void DrawBattle()
         DrawTextScaled("HP", 5, 118, WHITE);
 
         // Background Bar
-        DrawRectangle((int)hpX, (int)hpY, (int)hpW, (int)hpH, WHITE);
-        DrawRectangle((int)hpX + 2, (int)hpY + 2, (int)hpW - 4, (int)hpH - 4, BLACK);
+        GfxDrawRectangle((int)hpX, (int)hpY, (int)hpW, (int)hpH, WHITE);
+        GfxDrawRectangle((int)hpX + 2, (int)hpY + 2, (int)hpW - 4, (int)hpH - 4, BLACK);
 
         // Red Fill
         float fillPct = (float)player.hp / PLAYER_MAX_HP;
         if (fillPct < 0)
             fillPct = 0;
-        DrawRectangle((int)hpX + 2, (int)hpY + 2, (int)((hpW - 4) * fillPct), (int)hpH - 4, RED);
+        GfxDrawRectangle((int)hpX + 2, (int)hpY + 2, (int)((hpW - 4) * fillPct), (int)hpH - 4, RED);
 
         // HP Text
         char buffer[32];
@@ -736,7 +403,7 @@ void DrawBattle()
         DrawTextScaled(buffer, 80, 118, WHITE);
 
         // 5. Battle Box
-        DrawRectangleLinesEx(
+        GfxDrawRectangleLinesEx(
             {(float)currentBox.x * SCALE, (float)currentBox.y * SCALE,
              (float)currentBox.w * SCALE, (float)currentBox.h * SCALE},
             4.0f, WHITE);
@@ -749,19 +416,21 @@ void DrawBattle()
             float bw = currentBox.w * SCALE;
             float bh = currentBox.h * SCALE;
 
-            DrawTextScaled(opt1.c_str(), qTextX_Opt1, qTextY_Opt1, WHITE);
-            DrawTextScaled(opt2.c_str(), qTextX_Opt2, qTextY_Opt2, WHITE);
+            for (int i = 0; i < 2; i++)
+            {
+                const char *option = Str(battleQuestion->options[i]);
+                if (option[0] != '\0')
+                    DrawTextScaled(option, battleQuestion->optionX[i], battleQuestion->optionY[i], WHITE);
+            }
 
             // Divider Lines
-            bool isVerticalSplit = (battlePhase == B_Q1_WAIT || battlePhase == B_Q3_WAIT || battlePhase == B_Q5_WAIT);
-
-            if (isVerticalSplit)
+            if (battleQuestion->divider == DIVIDER_VERTICAL)
             {
-                DrawLineEx({bx + bw / 2, by + 4}, {bx + bw / 2, by + bh - 4}, 2.0f, GRAY);
+                GfxDrawLineEx({bx + bw / 2, by + 4}, {bx + bw / 2, by + bh - 4}, 2.0f, GRAY);
             }
-            else if (battlePhase == B_Q2_WAIT || battlePhase == B_Q4_WAIT)
+            else if (battleQuestion->divider == DIVIDER_HORIZONTAL)
             {
-                DrawLineEx({bx + 4, by + bh / 2}, {bx + bw - 4, by + bh / 2}, 2.0f, GRAY);
+                GfxDrawLineEx({bx + 4, by + bh / 2}, {bx + bw - 4, by + bh / 2}, 2.0f, GRAY);
             }
         }
 
@@ -772,7 +441,7 @@ void DrawBattle()
     // 8. Timer Bar (Yellow)
     if (isQuizWait)
     {
-        float timePct = 1.0f - (battleTimer / QUESTION_TIME);
+        float timePct = 1.0f - (battleTimer / battleQuestion->time);
         if (timePct < 0)
             timePct = 0;
 
@@ -781,6 +450,6 @@ void DrawBattle()
         float tw = timerBarRect.w * SCALE;
         float th = timerBarRect.h * SCALE;
 
-        DrawRectangle((int)tx, (int)ty, (int)(tw * timePct), (int)th, YELLOW);
+        GfxDrawRectangle((int)tx, (int)ty, (int)(tw * timePct), (int)th, YELLOW);
     }
 }
\ No newline at end of file
@@ -2,65 +2,94 @@
 #define BATTLE_H
 
 #include "game_defs.h"
+#include "StringIds.h"
 
 enum BattlePhase
 {
     B_INIT,
-
-    // Intro
-    B_Q1_DIALOGUE,
-
-    // Q1: Spelling
-    B_Q1_SETUP,
-    B_Q1_WAIT,
-    B_Q1_RESULT,
-
-    // Q2: Jacket
-    B_Q2_DIALOGUE,
-    B_Q2_SETUP,
-    B_Q2_WAIT,
-    B_Q2_RESULT,
-
-    // Q3: Partner
-    B_Q3_DIALOGUE,
-    B_Q3_SETUP,
-    B_Q3_WAIT,
-    B_Q3_RESULT,
-
-    // Q4: Grok
-    B_Q4_DIALOGUE,
-    B_Q4_SETUP,
-    B_Q4_WAIT,
-    B_Q4_RESULT,
-
-    // Q5: TSLA
-    B_Q5_DIALOGUE,
-    B_Q5_SETUP,
-    B_Q5_WAIT,
-    B_Q5_RESULT,
-
-    // Q6: AI Awareness (Tiny Box)
-    B_Q6_DIALOGUE,
-    B_Q6_SETUP,
-    B_Q6_WAIT,
-    B_Q6_RESULT,
-
-    // Q7: Consciousness (Tiny Box)
-    B_Q7_DIALOGUE,
-    B_Q7_SETUP,
-    B_Q7_WAIT,
-    B_Q7_RESULT,
-
-    // Ending
-    B_VICTORY,
+    B_INTRO,    // Robot's opening lines, no box yet
+    B_SETUP,    // One frame: shows the next question
+    B_WAIT,     // Timer running, the player picks a side
+    B_RESULT,   // Box shrunk, damage dealt
+    B_RESPONSE, // Robot reacts to the answer
+    B_VICTORY,  // Closing lines after the last question
     B_GAMEOVER_PHASE
 };
 
+// --- QUESTION RECORDS ---
+// Everything one question needs, in ESP32 coordinates (x SCALE on PC).
+// The battle runs a BattleScript's questions in order, so adding questions
+// only grows the table in BattleQuestions.cpp. Text is in
+// assets/strings.catalog.
+typedef StringId BattleText;
+
+enum BattleDivider
+{
+    DIVIDER_NONE,
+    DIVIDER_VERTICAL,  // Left / right answers
+    DIVIDER_HORIZONTAL // Top / bottom answers
+};
+
+enum BattleQuestionFlags
+{
+    BQ_BOX_AT_PLAYER = 1, // Safe rect is safe.w x safe.h where the heart is (a trap, no way out)
+    BQ_NO_SHRINK = 2      // Box stays as it is, no damage
+};
+
+struct BattleQuestion
+{
+    BattleText prompt;
+    BattleText options[2];
+    int optionX[2], optionY[2];
+
+    Rect box;           // Box at setup, w = 0 keeps the previous one
+    int startX, startY; // Heart at setup, -1 keeps it where it is
+
+    Rect safe;          // The box shrinks to this, outside it is a wrong answer
+    int resetX, resetY; // Where a wrong answer puts the heart
+    int divider;        // BattleDivider
+    int flags;          // BattleQuestionFlags
+
+    int wrongDamage;
+    int rightDamage;
+    int setHp; // >= 0: HP afterwards, whatever the answer
+
+    float time;       // Seconds to answer
+    float resultTime; // Seconds before the response
+
+    BattleText right;
+    BattleText wrong;
+};
+
+struct BattleLine
+{
+    BattleText text;
+    bool stopMusic;
+};
+
+struct BattleScript
+{
+    const BattleLine *intro;
+    int introCount;
+    const BattleQuestion *questions;
+    int questionCount;
+    const BattleLine *outro;
+    int outroCount;
+};
+
+// Defined in BattleQuestions.cpp
+extern const BattleScript robotBattle;
+
 void InitBattle();
 void UpdateBattle();
 void NewFunction();
 void DrawBattle();
 
+// While a question is running: the current box and the rect that is safe
+// from it. False when there is no safe side to reach.
+bool GetBattleSafeRect(Rect *box, Rect *safe);
+
+extern BattlePhase battlePhase;
 extern bool battleCompleted;
 extern float preBattleX;
 extern float preBattleY;
@@ -0,0 +1,137 @@
+#include "Battle.h"
+
+// --- ROBOT BATTLE ---
+// ESP32 coordinates. The box starts at {9, 41, 141, 72} and each safe rect
+// is what is left of the one before it.
+
+static const BattleLine introLines[] = {
+    {STR_BATTLE_INTRO_1, false},
+    {STR_BATTLE_INTRO_2, false},
+    {STR_BATTLE_INTRO_3, false},
+    {STR_BATTLE_INTRO_4, false},
+    {STR_BATTLE_INTRO_5, false},
+    {STR_BATTLE_INTRO_6, false},
+    {STR_BATTLE_INTRO_7, false},
+};
+
+static const BattleQuestion questions[] = {
+    // Q1: Baby (right side safe)
+    {STR_Q1_PROMPT,
+     {STR_Q1_OPTION_1, STR_Q1_OPTION_2},
+     {16, 88},
+     {67, 67},
+     {9, 41, 141, 72},
+     73, 71,
+     {79, 41, 70, 72},
+     108, 71,
+     DIVIDER_VERTICAL, 0,
+     8, 2, -1,
+     5.0f, 0.8f,
+     STR_Q1_RIGHT,
+     STR_Q1_WRONG},
+
+    // Q2: Jacket (top safe)
+    {STR_Q2_PROMPT,
+     {STR_Q2_OPTION_1, STR_Q2_OPTION_2},
+     {90, 88},
+     {55, 92},
+     {0, 0, 0, 0},
+     -1, -1,
+     {79, 41, 70, 36},
+     108, 53,
+     DIVIDER_HORIZONTAL, 0,
+     8, 2, -1,
+     5.0f, 0.8f,
+     STR_Q2_RIGHT,
+     STR_Q2_WRONG},
+
+    // Q3: Contract (left side safe)
+    {STR_Q3_PROMPT,
+     {STR_Q3_OPTION_1, STR_Q3_OPTION_2},
+     {90, 122},
+     {55, 52},
+     {0, 0, 0, 0},
+     -1, -1,
+     {79, 41, 35, 36},
+     90, 53,
+     DIVIDER_VERTICAL, 0,
+     8, 2, -1,
+     5.0f, 0.8f,
+     STR_Q3_RIGHT,
+     STR_Q3_WRONG},
+
+    // Q4: Partner (bottom safe)
+    {STR_Q4_PROMPT,
+     {STR_Q4_OPTION_1, STR_Q4_OPTION_2},
+     {85, 85},
+     {47, 65},
+     {0, 0, 0, 0},
+     -1, -1,
+     {79, 59, 35, 18},
+     90, 62,
+     DIVIDER_HORIZONTAL, 0,
+     8, 0, -1,
+     5.0f, 0.8f,
+     STR_Q4_RIGHT,
+     STR_Q4_WRONG},
+
+    // Q5: TSLA (left side safe)
+    {STR_Q5_PROMPT,
+     {STR_Q5_OPTION_1, STR_Q5_OPTION_2},
+     {82, 98},
+     {65, 65},
+     {0, 0, 0, 0},
+     -1, -1,
+     {77, 59, 17, 18},
+     81, 62,
+     DIVIDER_VERTICAL, 0,
+     8, 0, -1,
+     5.0f, 0.8f,
+     STR_Q5_RIGHT,
+     STR_Q5_WRONG},
+
+    // Q6: Crying friend (no answer, the box closes on the heart)
+    {STR_Q6_PROMPT,
+     {STR_NONE, STR_NONE},
+     {0, 0},
+     {0, 0},
+     {0, 0, 0, 0},
+     -1, -1,
+     {0, 0, 17, 17},
+     -1, -1,
+     DIVIDER_NONE, BQ_BOX_AT_PLAYER,
+     0, 0, 1,
+     3.0f, 0.8f,
+     STR_Q6_RESPONSE,
+     STR_Q6_RESPONSE},
+
+    // Q7: Grok (the robot breaks)
+    {STR_Q7_PROMPT,
+     {STR_NONE, STR_NONE},
+     {0, 0},
+     {0, 0},
+     {0, 0, 0, 0},
+     -1, -1,
+     {0, 0, 0, 0},
+     -1, -1,
+     DIVIDER_NONE, BQ_NO_SHRINK,
+     0, 0, -1,
+     3.0f, 1.0f,
+     STR_Q7_RESPONSE,
+     STR_Q7_RESPONSE},
+};
+
+static const BattleLine outroLines[] = {
+    {STR_BATTLE_OUTRO_1, false},
+    {STR_BATTLE_OUTRO_2, false},
+    {STR_BATTLE_OUTRO_3, false},
+    {STR_BATTLE_OUTRO_4, false},
+    {STR_BATTLE_OUTRO_5, true},
+};
+
+#define COUNT_OF(a) ((int)(sizeof(a) / sizeof((a)[0])))
+
+const BattleScript robotBattle = {
+    introLines, COUNT_OF(introLines),
+    questions, COUNT_OF(questions),
+    outroLines, COUNT_OF(outroLines)};
@@ -0,0 +1,114 @@
+#include "CoffeeLog.h"
+#include "Fonts.h"
+#include "Render.h"
+#include "Utils.h"
+
+void CoffeeLog::Push(const LogEntry &entry)
+{
+    if (count == COFFEE_LOG_CAPACITY)
+    {
+        head = (head + 1) % COFFEE_LOG_CAPACITY;
+        count--;
+        laidOut = 0; // Everything moves up a line
+    }
+
+    At(count) = entry;
+    count++;
+}
+
+void CoffeeLog::Clear()
+{
+    head = 0;
+    count = 0;
+    laidOut = 0;
+}
+
+static void DrawEntry(const LogEntry &entry, Font font, Vector2 pos, float fontSize, float spacing)
+{
+    const char *text = entry.text.c_str();
+    if (entry.isChaotic)
+    {
+        DrawTextJitter(font, text, {pos.x - 2, pos.y + 1}, fontSize, spacing, BLUE);
+        DrawTextJitter(font, text, {pos.x + 2, pos.y - 1}, fontSize, spacing, GREEN);
+        DrawTextJitter(font, text, pos, fontSize, spacing, RED);
+    }
+    else if (entry.shakeIntensity > 0)
+    {
+        DrawTextJitter(font, text, pos, fontSize, spacing, entry.color);
+    }
+    else
+    {
+        GfxDrawTextEx(font, text, pos, fontSize, spacing, entry.color);
+    }
+}
+
+float CoffeeLog::Draw(Font font, float startX, float startY, float fontSize, float spacing,
+                      const char *pinnedLine, float pinnedY)
+{
+    if (count == 0)
+        return startY;
+
+    if (font.texture.id != fontId || fontSize != layoutFontSize || spacing != layoutSpacing ||
+        startX != layoutX || startY != layoutY || layoutPinned != pinnedLine)
+    {
+        fontId = font.texture.id;
+        layoutFontSize = fontSize;
+        layoutSpacing = spacing;
+        layoutX = startX;
+        layoutY = startY;
+        layoutPinned = pinnedLine;
+        laidOut = 0;
+    }
+
+    if (!layerLoaded)
+    {
+        layer = GfxLoadLayer(GAME_WIDTH, GAME_HEIGHT);
+        layerLoaded = true;
+        laidOut = 0;
+    }
+
+    // Only lines pushed since the last frame are drawn into the layer
+    if (laidOut < count)
+    {
+        GfxBeginLayer(layer);
+        if (laidOut == 0)
+        {
+            GfxClearBackground(BLANK);
+            endY = startY;
+        }
+
+        for (int i = laidOut; i < count; i++)
+        {
+            const LogEntry &entry = At(i);
+            Vector2 size = MeasureGameText(font, entry.text.c_str(), fontSize, spacing);
+
+            Vector2 pos = {startX, endY};
+            if (entry.text == layoutPinned)
+                pos.y = pinnedY;
+            if (entry.centered)
+                pos.x = (GAME_WIDTH - size.x) / 2.0f;
+
+            // Lines that run off the bottom are never seen
+            if (pos.y < GAME_HEIGHT)
+                DrawEntry(entry, font, pos, fontSize, spacing);
+
+            endY += size.y + entry.spacing;
+        }
+
+        GfxEndLayer();
+        laidOut = count;
+    }
+
+    float w = (float)layer.texture.width;
+    float h = (float)layer.texture.height;
+    GfxDrawTexturePro(layer.texture, {0.0f, 0.0f, w, -h}, {0.0f, 0.0f, w, h}, {0.0f, 0.0f}, 0.0f, WHITE);
+    return endY;
+}
+
+void CoffeeLog::Unload()
+{
+    if (layerLoaded)
+        GfxUnloadLayer(layer);
+    layerLoaded = false;
+    Clear();
+}
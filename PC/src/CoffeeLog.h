@@ -0,0 +1,59 @@
+#ifndef COFFEE_LOG_H
+#define COFFEE_LOG_H
+
+#include "game_defs.h"
+
+// --- COFFEE EVENT HISTORY ---
+// Lines the coffee event has finished typing. They never change once pushed,
+// so each one is measured and drawn once into a retained layer, and the whole
+// history costs one texture draw per frame. Only the line being typed is
+// drawn live.
+struct LogEntry
+{
+    std::string text;
+    Color color;
+    int shakeIntensity; // 0 = None, 1 = Low, 2 = Medium, 3+ = High
+    bool centered;      // true = Center on screen, false = Left aligned
+    float spacing;      // Space after this line (default 10)
+    bool isChaotic;
+};
+
+// Fixed-size ring: when full the oldest line is dropped and the rest move up
+#define COFFEE_LOG_CAPACITY 16
+
+class CoffeeLog
+{
+public:
+    void Push(const LogEntry &entry);
+    void Clear();
+    bool Empty() const { return count == 0; }
+
+    // Draws the history from (startX, startY) down. pinnedLine is always
+    // drawn at pinnedY. Returns the Y below the last line.
+    float Draw(Font font, float startX, float startY, float fontSize, float spacing,
+               const char *pinnedLine, float pinnedY);
+
+    void Unload();
+
+private:
+    LogEntry entries[COFFEE_LOG_CAPACITY];
+    Vector2 positions[COFFEE_LOG_CAPACITY]; // Top left of each line, once laid out
+    int head = 0;  // Oldest line
+    int count = 0;
+    int laidOut = 0; // Lines with a position and already in the layer
+    float endY = 0.0f;
+
+    // What the layer was drawn with; any change redraws it from scratch
+    unsigned int fontId = 0;
+    float layoutFontSize = 0.0f, layoutSpacing = 0.0f;
+    float layoutX = 0.0f, layoutY = 0.0f;
+    std::string layoutPinned;
+
+    RenderTexture2D layer = {};
+    bool layerLoaded = false;
+
+    LogEntry &At(int i) { return entries[(head + i) % COFFEE_LOG_CAPACITY]; }
+    Vector2 &PositionAt(int i) { return positions[(head + i) % COFFEE_LOG_CAPACITY]; }
+};
+
+#endif
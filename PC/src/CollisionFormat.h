@@ -0,0 +1,36 @@
+#ifndef COLLISION_FORMAT_H
+#define COLLISION_FORMAT_H
+
+#include <stdint.h>
+
+// --- BAKED WALKABLE FLOOR (.bin) ---
+// Written by tools/CollisionBaker.cpp from assets/background_walk.png, read
+// by the PC game. Layout, little endian:
+//   CollisionMapHeader
+//   rectCount x CollisionRect                     greedy rect cover of the floor
+//   maskHeight x wordsPerRow x uint64_t           one bit per pixel, rows top down
+// The mask covers the floor's bounding box, starting at (maskX, maskY).
+
+#define COLLISION_MAGIC 0x4C435455 // "UTCL"
+#define COLLISION_VERSION 1
+
+struct CollisionMapHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    int16_t maskX;
+    int16_t maskY;
+    uint16_t maskWidth;
+    uint16_t maskHeight;
+    uint16_t wordsPerRow;
+    uint16_t rectCount;
+    uint32_t reserved; // Keeps the tables 8-byte aligned
+};
+
+// Same meaning as Rect: edges inclusive, so a single pixel is w = h = 0
+struct CollisionRect
+{
+    int16_t x, y, w, h;
+};
+
+#endif
@@ -0,0 +1,54 @@
+#include "CollisionMap.h"
+#include "CollisionFormat.h"
+#include "AssetLoader.h"
+#include <cstring>
+
+bool LoadCollisionMap(const char *name, std::vector<Rect> *zones, CollisionMask *mask)
+{
+    int size = 0;
+    unsigned char *owned = nullptr;
+    const unsigned char *data = ReadAssetData(name, &size, &owned);
+    if (data == nullptr)
+        return false;
+
+    bool ok = LoadCollisionMapFromMemory(data, size, zones, mask);
+    if (!ok)
+        TraceLog(LOG_WARNING, "%s is not a valid collision map", name);
+
+    if (owned != nullptr)
+        UnloadFileData(owned);
+    return ok;
+}
+
+bool LoadCollisionMapFromMemory(const unsigned char *data, int size, std::vector<Rect> *zones, CollisionMask *mask)
+{
+    zones->clear();
+    mask->Clear();
+
+    CollisionMapHeader header;
+    if (size < (int)sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != COLLISION_MAGIC || header.version != COLLISION_VERSION ||
+        header.wordsPerRow != (header.maskWidth + 63) / 64)
+        return false;
+
+    size_t rectBytes = (size_t)header.rectCount * sizeof(CollisionRect);
+    size_t maskWords = (size_t)header.wordsPerRow * header.maskHeight;
+    if (sizeof(header) + rectBytes + maskWords * sizeof(uint64_t) > (size_t)size)
+        return false;
+
+    const unsigned char *p = data + sizeof(header);
+    for (int i = 0; i < header.rectCount; i++)
+    {
+        CollisionRect r;
+        memcpy(&r, p + i * sizeof(CollisionRect), sizeof(r));
+        zones->push_back({r.x, r.y, r.w, r.h});
+    }
+
+    // Pack slices aren't guaranteed to be 8-byte aligned
+    std::vector<uint64_t> bits(maskWords);
+    memcpy(bits.data(), p + rectBytes, maskWords * sizeof(uint64_t));
+    mask->Assign(header.maskX, header.maskY, header.maskWidth, header.maskHeight, bits.data());
+    return true;
+}
@@ -0,0 +1,14 @@
+#ifndef COLLISION_MAP_H
+#define COLLISION_MAP_H
+
+#include "CollisionMask.h"
+
+// --- WALKABLE FLOOR ---
+// The map's floor, baked at build time by tools/CollisionBaker from the mask
+// painted over the background (assets/background_walk.png). Fills both the
+// rect cover and the bit grid; false (and both left empty) if the file is
+// missing or invalid.
+bool LoadCollisionMap(const char *name, std::vector<Rect> *zones, CollisionMask *mask);
+bool LoadCollisionMapFromMemory(const unsigned char *data, int size, std::vector<Rect> *zones, CollisionMask *mask);
+
+#endif
@@ -0,0 +1,87 @@
+#include "CollisionMask.h"
+#include <algorithm>
+
+void CollisionMask::Clear()
+{
+    originX = originY = 0;
+    width = height = stride = 0;
+    words.clear();
+}
+
+void CollisionMask::Assign(int x, int y, int w, int h, const uint64_t *bits)
+{
+    Clear();
+    if (w <= 0 || h <= 0)
+        return;
+
+    originX = x;
+    originY = y;
+    width = w;
+    height = h;
+    stride = (width + 63) / 64;
+    words.assign(bits, bits + (size_t)stride * height);
+}
+
+void CollisionMask::SetSpan(int row, int x0, int x1)
+{
+    uint64_t *line = &words[(size_t)row * stride];
+    int first = x0 >> 6, last = x1 >> 6;
+    uint64_t headMask = ~0ULL << (x0 & 63);
+    uint64_t tailMask = ~0ULL >> (63 - (x1 & 63));
+
+    if (first == last)
+    {
+        line[first] |= headMask & tailMask;
+        return;
+    }
+    line[first] |= headMask;
+    for (int i = first + 1; i < last; i++)
+        line[i] = ~0ULL;
+    line[last] |= tailMask;
+}
+
+void CollisionMask::Build(const std::vector<Rect> &zones)
+{
+    Clear();
+
+    // Bounding box of every zone, edges included
+    bool any = false;
+    int minX = 0, minY = 0, maxX = 0, maxY = 0;
+    for (const Rect &r : zones)
+    {
+        if (r.w < 0 || r.h < 0)
+            continue;
+        if (!any)
+        {
+            minX = r.x;
+            minY = r.y;
+            maxX = r.x + r.w;
+            maxY = r.y + r.h;
+            any = true;
+            continue;
+        }
+        minX = std::min(minX, r.x);
+        minY = std::min(minY, r.y);
+        maxX = std::max(maxX, r.x + r.w);
+        maxY = std::max(maxY, r.y + r.h);
+    }
+    if (!any)
+        return;
+
+    originX = minX;
+    originY = minY;
+    width = maxX - minX + 1;
+    height = maxY - minY + 1;
+    stride = (width + 63) / 64;
+    words.assign((size_t)stride * height, 0);
+
+    for (const Rect &r : zones)
+    {
+        if (r.w < 0 || r.h < 0)
+            continue;
+        int x0 = r.x - originX, x1 = x0 + r.w;
+        int y0 = r.y - originY;
+        for (int y = y0; y <= y0 + r.h; y++)
+            SetSpan(y, x0, x1);
+    }
+}
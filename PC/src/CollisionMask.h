@@ -0,0 +1,40 @@
+#ifndef COLLISION_MASK_H
+#define COLLISION_MASK_H
+
+#include "game_defs.h"
+#include <cstdint>
+
+// --- WALKABLE MASK ---
+// Walkable zones baked into one bit per pixel over their bounding box when
+// they are set, so testing a point is one shift and mask however many zones
+// (or pixel-precise shapes) there are. Zone edges are inclusive, the same as
+// the rect test it replaces.
+class CollisionMask
+{
+public:
+    void Build(const std::vector<Rect> &zones);
+    // Takes bits baked elsewhere: height rows of (width + 63) / 64 words
+    void Assign(int x, int y, int w, int h, const uint64_t *bits);
+    void Clear();
+    bool Empty() const { return words.empty(); }
+
+    bool Test(int x, int y) const
+    {
+        // Negative offsets wrap to huge values, one compare per axis
+        unsigned int cx = (unsigned int)(x - originX);
+        unsigned int cy = (unsigned int)(y - originY);
+        if (cx >= (unsigned int)width || cy >= (unsigned int)height)
+            return false;
+        return (words[cy * stride + (cx >> 6)] >> (cx & 63)) & 1;
+    }
+
+private:
+    int originX = 0, originY = 0;
+    int width = 0, height = 0;
+    int stride = 0; // 64-bit words per row
+    std::vector<uint64_t> words;
+
+    void SetSpan(int row, int x0, int x1); // Inclusive, mask coordinates
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include "Dialogue.h"
+#include "AssetLoader.h"
+#include "raylib.h"
+#include <cstring>
+#include <vector>
+
+static std::vector<DialogueNode> nodes;
+static std::vector<DialogueVariant> variants;
+static std::vector<DialogueOption> options;
+static std::vector<uint32_t> stringOffsets;
+static std::vector<char> text;
+
+bool LoadDialogueScript(const char *name)
+{
+    int size = 0;
+    unsigned char *owned = nullptr;
+    const unsigned char *data = ReadAssetData(name, &size, &owned);
+    if (data == nullptr)
+        return false;
+
+    bool ok = LoadDialogueScriptFromMemory(data, size);
+    if (!ok)
+        TraceLog(LOG_WARNING, "%s is not a valid dialogue script", name);
+
+    if (owned != nullptr)
+        UnloadFileData(owned);
+    return ok;
+}
+
+// Copies one table out of the file; false if it runs past the end
+template <typename T>
+static bool ReadTable(const unsigned char *data, int size, size_t *offset, int count, std::vector<T> *out)
+{
+    size_t bytes = (size_t)count * sizeof(T);
+    if (*offset + bytes > (size_t)size)
+        return false;
+
+    out->resize(count);
+    if (bytes > 0)
+        memcpy(out->data(), data + *offset, bytes);
+    *offset += bytes;
+    return true;
+}
+
+bool LoadDialogueScriptFromMemory(const unsigned char *data, int size)
+{
+    DialogueScriptHeader header;
+    if (size < (int)sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != DIALOGUE_MAGIC || header.version != DIALOGUE_VERSION)
+        return false;
+
+    size_t offset = sizeof(header);
+    if (!ReadTable(data, size, &offset, header.nodeCount, &nodes) ||
+        !ReadTable(data, size, &offset, header.variantCount, &variants) ||
+        !ReadTable(data, size, &offset, header.optionCount, &options) ||
+        !ReadTable(data, size, &offset, header.stringCount * DIALOGUE_COLUMNS, &stringOffsets) ||
+        !ReadTable(data, size, &offset, (int)header.textBytes, &text))
+    {
+        nodes.clear();
+        return false;
+    }
+
+    // Every string must end inside the blob
+    if (!text.empty())
+        text.back() = '\0';
+    for (uint32_t &stringOffset : stringOffsets)
+    {
+        if (stringOffset >= text.size())
+            stringOffset = 0;
+    }
+
+    return true;
+}
+
+int GetDialogueNodeCount()
+{
+    return (int)nodes.size();
+}
+
+int FindDialogueNode(const char *name)
+{
+    for (int i = 0; i < (int)nodes.size(); i++)
+    {
+        if (strncmp(nodes[i].name, name, DIALOGUE_NAME_LEN) == 0)
+            return i;
+    }
+    return -1;
+}
+
+const DialogueNode *GetDialogueNode(int index)
+{
+    if (index < 0 || index >= (int)nodes.size())
+        return nullptr;
+    return &nodes[index];
+}
+
+const DialogueOption *GetDialogueOption(const DialogueNode *node, int i)
+{
+    int index = node->firstOption + i;
+    if (i < 0 || i >= node->optionCount || index >= (int)options.size())
+        return nullptr;
+    return &options[index];
+}
+
+const char *GetDialogueLine(const DialogueNode *node, int value, int column)
+{
+    int fallback = -1;
+    for (int i = 0; i < node->variantCount; i++)
+    {
+        int index = node->firstVariant + i;
+        if (index >= (int)variants.size())
+            break;
+
+        if (variants[index].match == value)
+            return GetDialogueString(variants[index].text, column);
+        if (variants[index].match == DIALOGUE_ANY && fallback < 0)
+            fallback = variants[index].text;
+    }
+    return (fallback >= 0) ? GetDialogueString(fallback, column) : "";
+}
+
+const char *GetDialogueString(int id, int column)
+{
+    size_t index = (size_t)id * DIALOGUE_COLUMNS + column;
+    if (id < 0 || column < 0 || column >= DIALOGUE_COLUMNS || index >= stringOffsets.size())
+        return "";
+    return text.data() + stringOffsets[index];
+}
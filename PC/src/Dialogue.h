@@ -0,0 +1,27 @@
+#ifndef DIALOGUE_H
+#define DIALOGUE_H
+
+#include "DialogueFormat.h"
+
+// --- DIALOGUE SCRIPT ---
+// The robot's dialogue as data: assets/dialogue.bin, compiled from
+// assets/dialogue.script by tools/DialogueCompiler. HandleDialogue() in
+// main.cpp interprets it one node at a time.
+
+// From the asset pack or assets/. Keeps its own copy of the bytes.
+bool LoadDialogueScript(const char *name);
+bool LoadDialogueScriptFromMemory(const unsigned char *data, int size);
+
+int GetDialogueNodeCount();
+int FindDialogueNode(const char *name); // -1 if there is no such node
+
+// nullptr when out of range
+const DialogueNode *GetDialogueNode(int index);
+const DialogueOption *GetDialogueOption(const DialogueNode *node, int i);
+
+// Text of the first variant matching value (or the DIALOGUE_ANY one) in the
+// given DIALOGUE_COL_*, "" if none
+const char *GetDialogueLine(const DialogueNode *node, int value, int column);
+const char *GetDialogueString(int id, int column);
+
+#endif
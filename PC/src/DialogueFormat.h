@@ -0,0 +1,121 @@
+#ifndef DIALOGUE_FORMAT_H
+#define DIALOGUE_FORMAT_H
+
+#include <stdint.h>
+
+// --- COMPILED DIALOGUE SCRIPT (.bin) ---
+// Written by tools/DialogueCompiler.cpp from assets/dialogue.script and read
+// by both the PC game and the ESP32 sketch (which keeps a copy of this file).
+// Layout, little endian:
+//   DialogueScriptHeader
+//   nodeCount    x DialogueNode
+//   variantCount x DialogueVariant
+//   optionCount  x DialogueOption
+//   stringCount  x DIALOGUE_COLUMNS x uint32_t offsets into the text blob
+//   textBytes of NUL terminated UTF-8 strings
+// Every table starts 4-byte aligned, so the ESP32 reads it in place.
+
+#define DIALOGUE_MAGIC 0x4C445455 // "UTDL"
+#define DIALOGUE_VERSION 1
+#define DIALOGUE_NAME_LEN 24
+
+// One string per column: English, Chinese, and the short English used on the
+// ESP32's 160x128 screen
+#define DIALOGUE_COLUMNS 3
+#define DIALOGUE_COL_EN 0
+#define DIALOGUE_COL_CN 1
+#define DIALOGUE_COL_LCD 2
+
+#define DIALOGUE_EXIT -1       // next: leave the dialogue, back to the map
+#define DIALOGUE_ANY -32768    // variant match: used when nothing else matches
+#define DIALOGUE_NO_STRING 0xFFFF
+
+enum DialogueNodeType
+{
+    DNODE_LINE,   // Types its text, Z moves on to next
+    DNODE_CHOICE, // Options side by side, Z picks one
+    DNODE_ITEMS,  // Options that are inventory items the player still has
+    DNODE_EVENT   // Hands over to a scripted event in code
+};
+
+// Game variables the script can read and write
+enum DialogueVar
+{
+    DVAR_NONE,
+    DVAR_CHOICE, // Last yes/no answer
+    DVAR_STORY,  // storyProgress
+    DVAR_ITEM    // Last item given
+};
+
+enum DialogueOp
+{
+    DOP_NONE,
+    DOP_SET,
+    DOP_ADD // Clamped to actionMax
+};
+
+enum DialogueWhen
+{
+    DWHEN_ENTER, // First frame of the node
+    DWHEN_NEXT   // When the player moves on
+};
+
+enum DialogueItem
+{
+    DITEM_COFFEE,
+    DITEM_GAS,
+    DITEM_BATTERY
+};
+
+enum DialogueEvent
+{
+    DEVENT_COFFEE
+};
+
+struct DialogueScriptHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint16_t nodeCount;
+    uint16_t variantCount;
+    uint16_t optionCount;
+    uint16_t stringCount;
+    uint32_t textBytes;
+};
+
+struct DialogueNode
+{
+    char name[DIALOGUE_NAME_LEN];
+    uint8_t type;      // DialogueNodeType
+    uint8_t var;       // LINE: picks the text variant. CHOICE/ITEMS: receives the pick
+    uint8_t firstVariant;
+    uint8_t variantCount;
+    uint8_t firstOption;
+    uint8_t optionCount;
+    uint8_t actionWhen; // DialogueWhen
+    uint8_t actionOp;   // DialogueOp
+    uint8_t actionVar;  // DialogueVar
+    uint8_t event;      // DialogueEvent, EVENT nodes only
+    int16_t actionValue;
+    int16_t actionMax;
+    int16_t speed;   // ms per character, -1 = the platform's default
+    uint16_t waitMs; // Input ignored for this long after the node starts
+    int16_t next;    // Node index or DIALOGUE_EXIT
+};
+
+struct DialogueVariant
+{
+    int16_t match; // Value of the node's var, or DIALOGUE_ANY
+    uint16_t text;
+};
+
+struct DialogueOption
+{
+    uint16_t text;
+    int16_t x;    // PC layout: label x inside the dialogue box
+    int16_t next; // Node index or DIALOGUE_EXIT
+    uint8_t item; // DialogueItem, ITEMS nodes only
+    uint8_t reserved;
+};
+
+#endif
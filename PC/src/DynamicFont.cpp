@@ -0,0 +1,198 @@
+#include "DynamicFont.h"
+#include <cstring>
+
+DynamicFont lazyFontCN;
+
+bool DynamicFont::Load(const char *fileName, int baseSize, int size, int slotCapacity)
+{
+    int dataSize = 0;
+    unsigned char *data = LoadFileData(fileName, &dataSize);
+    if (data == nullptr)
+        return false;
+
+    return LoadFromMemory(data, dataSize, baseSize, size, slotCapacity);
+}
+
+bool DynamicFont::LoadFromMemory(unsigned char *data, int dataSize, int baseSize, int size, int slotCapacity)
+{
+    fileData = data;
+    fileSize = dataSize;
+    atlasSize = size;
+
+    // Empty GRAY_ALPHA atlas (same format GenImageFontAtlas produces)
+    Image blank = {0};
+    blank.data = MemAlloc(atlasSize * atlasSize * 2);
+    blank.width = atlasSize;
+    blank.height = atlasSize;
+    blank.mipmaps = 1;
+    blank.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+
+    font.baseSize = baseSize;
+    font.glyphPadding = 4;
+    font.glyphCount = slotCapacity;
+    font.glyphs = (GlyphInfo *)MemAlloc(slotCapacity * sizeof(GlyphInfo));
+    font.recs = (Rectangle *)MemAlloc(slotCapacity * sizeof(Rectangle));
+    font.texture = LoadTextureFromImage(blank);
+    UnloadImage(blank);
+
+    cells.assign(slotCapacity, {0, 0, 0, 0});
+    lastUsed.assign(slotCapacity, -1);
+    shelves.clear();
+    slotOfCodepoint.clear();
+    slotsUsed = 0;
+
+    return font.texture.id != 0;
+}
+
+void DynamicFont::Unload()
+{
+    if (font.texture.id != 0)
+        UnloadFont(font);
+    font = {0};
+
+    if (fileData != nullptr)
+        UnloadFileData(fileData);
+    fileData = nullptr;
+}
+
+// Shelf packing: first shelf tall enough with room left, else a new shelf
+bool DynamicFont::PackCell(int cellW, int cellH, Rectangle *cell)
+{
+    for (Shelf &shelf : shelves)
+    {
+        if (cellH <= shelf.height && shelf.nextX + cellW <= atlasSize)
+        {
+            *cell = {(float)shelf.nextX, (float)shelf.y, (float)cellW, (float)shelf.height};
+            shelf.nextX += cellW;
+            return true;
+        }
+    }
+
+    int top = shelves.empty() ? 0 : shelves.back().y + shelves.back().height;
+    if (top + cellH > atlasSize || cellW > atlasSize)
+        return false;
+
+    shelves.push_back({top, cellH, cellW});
+    *cell = {0.0f, (float)top, (float)cellW, (float)cellH};
+    return true;
+}
+
+int DynamicFont::AllocateSlot(int cellW, int cellH)
+{
+    // 1. Free slot with fresh atlas space
+    if (slotsUsed < font.glyphCount)
+    {
+        Rectangle cell;
+        if (PackCell(cellW, cellH, &cell))
+        {
+            cells[slotsUsed] = cell;
+            return slotsUsed++;
+        }
+    }
+
+    // 2. Atlas or slots full: reuse the least recently used cell that fits,
+    // but never one drawn this frame (its quads may still be in the batch)
+    int victim = -1;
+    for (int i = 0; i < slotsUsed; i++)
+    {
+        if (lastUsed[i] >= frame)
+            continue;
+        if (cells[i].width < cellW || cells[i].height < cellH)
+            continue;
+        if (victim < 0 || lastUsed[i] < lastUsed[victim])
+            victim = i;
+    }
+
+    if (victim >= 0)
+    {
+        slotOfCodepoint.erase(font.glyphs[victim].value);
+        glyphsEvicted++;
+    }
+    return victim;
+}
+
+void DynamicFont::EnsureGlyph(int codepoint)
+{
+    // Line breaks are never drawn
+    if (codepoint == '\n')
+        return;
+
+    auto it = slotOfCodepoint.find(codepoint);
+    if (it != slotOfCodepoint.end())
+    {
+        lastUsed[it->second] = frame;
+        return;
+    }
+
+    int cp = codepoint;
+    GlyphInfo *g = LoadFontData(fileData, fileSize, font.baseSize, &cp, 1, FONT_DEFAULT);
+    if (g == nullptr)
+        return;
+
+    if (g[0].image.data == nullptr && codepoint != ' ')
+        TraceLog(LOG_WARNING, "Glyph U+%04X is missing from the Chinese font", codepoint);
+
+    int pad = font.glyphPadding;
+    int w = g[0].image.width;
+    int h = g[0].image.height;
+    int slot = AllocateSlot(w + 2 * pad, h + 2 * pad);
+    if (slot < 0)
+    {
+        TraceLog(LOG_WARNING, "Chinese glyph atlas is full, U+%04X not drawn", codepoint);
+        UnloadFontData(g, 1);
+        return;
+    }
+
+    // Upload the whole cell so the evicted glyph's pixels are cleared too
+    Rectangle cell = cells[slot];
+    int cellW = (int)cell.width;
+    int cellH = (int)cell.height;
+    uploadBuffer.assign(cellW * cellH * 2, 0);
+    const unsigned char *src = (const unsigned char *)g[0].image.data;
+    for (int y = 0; src != nullptr && y < h; y++)
+    {
+        for (int x = 0; x < w; x++)
+        {
+            unsigned char *dst = &uploadBuffer[((y + pad) * cellW + (x + pad)) * 2];
+            dst[0] = 255;
+            dst[1] = src[y * w + x];
+        }
+    }
+    UpdateTextureRec(font.texture, cell, uploadBuffer.data());
+
+    font.glyphs[slot].value = codepoint;
+    font.glyphs[slot].offsetX = g[0].offsetX;
+    font.glyphs[slot].offsetY = g[0].offsetY;
+    font.glyphs[slot].advanceX = g[0].advanceX;
+    font.glyphs[slot].image = {0};
+    font.recs[slot] = {cell.x + pad, cell.y + pad, (float)w, (float)h};
+
+    slotOfCodepoint[codepoint] = slot;
+    lastUsed[slot] = frame;
+    glyphsRasterized++;
+
+    UnloadFontData(g, 1);
+}
+
+void DynamicFont::EnsureText(const char *text)
+{
+    int i = 0;
+    while (text[i] != '\0')
+    {
+        int bytesProcessed = 0;
+        EnsureGlyph(GetCodepointNext(&text[i], &bytesProcessed));
+        i += bytesProcessed;
+    }
+}
+
+void EnsureFontGlyphs(Font font, const char *text)
+{
+    if (lazyFontCN.Owns(font))
+        lazyFontCN.EnsureText(text);
+}
+
+void EnsureFontGlyph(Font font, int codepoint)
+{
+    if (lazyFontCN.Owns(font))
+        lazyFontCN.EnsureGlyph(codepoint);
+}
@@ -0,0 +1,68 @@
+#ifndef DYNAMIC_FONT_H
+#define DYNAMIC_FONT_H
+
+#include "raylib.h"
+#include <unordered_map>
+#include <vector>
+
+// --- LAZY GLYPH ATLAS ---
+// A font whose glyphs are rasterized from the TTF the first time they are
+// drawn or measured, and shelf-packed into one fixed-size texture. When the
+// texture is full the least recently used glyph (not used this frame) is
+// evicted and its cell reused.
+//
+// font.glyphCount is fixed at the slot capacity so copies of the Font struct
+// (GetCurrentFont() returns by value) stay valid as glyphs come and go.
+// Empty slots have codepoint 0.
+class DynamicFont
+{
+public:
+    Font font = {0};
+
+    // Stats
+    int glyphsRasterized = 0;
+    int glyphsEvicted = 0;
+
+    bool Load(const char *fileName, int baseSize, int atlasSize, int slotCapacity);
+    // Takes ownership of data (a LoadFileData() buffer), freed by Unload()
+    bool LoadFromMemory(unsigned char *data, int dataSize, int baseSize, int atlasSize, int slotCapacity);
+    void Unload();
+
+    bool Owns(Font other) const { return font.texture.id != 0 && other.texture.id == font.texture.id; }
+
+    // Makes sure the glyph is in the atlas and marks it used this frame
+    void EnsureGlyph(int codepoint);
+    void EnsureText(const char *text);
+
+    // Advances the LRU clock; call once per frame
+    void NewFrame() { frame++; }
+
+private:
+    struct Shelf
+    {
+        int y, height, nextX;
+    };
+
+    unsigned char *fileData = nullptr;
+    int fileSize = 0;
+    int atlasSize = 0;
+    long frame = 0;
+
+    std::unordered_map<int, int> slotOfCodepoint;
+    std::vector<Rectangle> cells; // Atlas cell of each slot, padding included
+    std::vector<long> lastUsed;
+    std::vector<Shelf> shelves;
+    int slotsUsed = 0;
+    std::vector<unsigned char> uploadBuffer;
+
+    int AllocateSlot(int cellW, int cellH);
+    bool PackCell(int cellW, int cellH, Rectangle *cell);
+};
+
+extern DynamicFont lazyFontCN;
+
+// No-ops unless the font is a lazy one
+void EnsureFontGlyphs(Font font, const char *text);
+void EnsureFontGlyph(Font font, int codepoint);
+
+#endif
@@ -0,0 +1,276 @@
+#include "Fonts.h"
+#include "Globals.h"
+#include "BakedFont.h"
+#include "GlyphCache.h"
+#include "TextLayout.h"
+#include "DynamicFont.h"
+#include "AssetPack.h"
+#include "AssetLoader.h"
+#include "Profiler.h"
+#include <cstring>
+
+// Rasterize CN glyphs on first use instead of the whole dialogue file at startup
+const bool LAZY_CN_FONT = true;
+
+#define CN_FONT_PATH "assets/fusion-pixel-12px-proportional-zh_hant.ttf"
+
+Vector2 MeasureGameText(Font font, const char *text, float fontSize, float spacing)
+{
+    EnsureFontGlyphs(font, text);
+    return MeasureTextEx(font, text, fontSize, spacing);
+}
+
+Font LoadBakedFont(const char *fileName)
+{
+    int dataSize = 0;
+    unsigned char *data = LoadFileData(fileName, &dataSize);
+    if (data == nullptr)
+        return {0};
+
+    Font font = LoadBakedFontFromMemory(data, dataSize);
+    if (font.texture.id == 0)
+        TraceLog(LOG_WARNING, "%s is not a valid baked font", fileName);
+
+    UnloadFileData(data);
+    return font;
+}
+
+bool ParseBakedFont(const unsigned char *data, int dataSize, Font *out, Image *atlas)
+{
+    Font font = {0};
+
+    BakedFontHeader header;
+    if (dataSize < (int)sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+
+    size_t tableBytes = (size_t)header.glyphCount * sizeof(BakedGlyph);
+    if (header.magic != BAKED_FONT_MAGIC || header.version != BAKED_FONT_VERSION ||
+        header.glyphCount <= 0 ||
+        (size_t)dataSize < sizeof(header) + tableBytes + header.pixelBytes)
+        return false;
+
+    // Allocated with raylib's allocator so UnloadFont() can free them
+    font.baseSize = header.baseSize;
+    font.glyphPadding = header.glyphPadding;
+    font.glyphCount = header.glyphCount;
+    font.glyphs = (GlyphInfo *)MemAlloc(header.glyphCount * sizeof(GlyphInfo));
+    font.recs = (Rectangle *)MemAlloc(header.glyphCount * sizeof(Rectangle));
+
+    const unsigned char *table = data + sizeof(header);
+    for (int i = 0; i < header.glyphCount; i++)
+    {
+        BakedGlyph g;
+        memcpy(&g, table + i * sizeof(BakedGlyph), sizeof(g));
+
+        font.glyphs[i].value = g.codepoint;
+        font.glyphs[i].offsetX = g.offsetX;
+        font.glyphs[i].offsetY = g.offsetY;
+        font.glyphs[i].advanceX = g.advanceX;
+        font.recs[i] = {g.recX, g.recY, g.recWidth, g.recHeight};
+    }
+
+    *atlas = {0};
+    atlas->data = (void *)(data + sizeof(header) + tableBytes);
+    atlas->width = header.atlasWidth;
+    atlas->height = header.atlasHeight;
+    atlas->mipmaps = 1;
+    atlas->format = header.atlasFormat;
+
+    *out = font;
+    return true;
+}
+
+Font LoadBakedFontFromMemory(const unsigned char *data, int dataSize)
+{
+    Font font = {0};
+    Image atlas;
+    if (!ParseBakedFont(data, dataSize, &font, &atlas))
+        return font;
+
+    // The pixels are uploaded straight from the buffer
+    font.texture = LoadTextureFromImage(atlas);
+    return font;
+}
+
+// Fallback when there is no baked atlas: rasterize every codepoint of the
+// CN dialogue text at startup. CPU only, the atlas is uploaded by UploadFont().
+static void RasterizeFontCN(Font *font, Image *atlas)
+{
+    char *textToLoad = LoadFileText("assets/dialogues_CN.txt");
+    int codepointCount = 0;
+    int *codepoints = NULL;
+
+    if (textToLoad != nullptr)
+    {
+        codepoints = LoadCodepoints(textToLoad, &codepointCount);
+        UnloadFileText(textToLoad);
+    }
+    else
+    {
+        TraceLog(LOG_WARNING, "dialogues_CN.txt not found! Loading UI chars only.");
+
+        // If the file is missing
+        const char *fallbackText = "傳說之上下左右按切換中文是的不是給予拒絕咖啡汽油電池";
+        codepoints = LoadCodepoints(fallbackText, &codepointCount);
+    }
+
+    // Load Font Data (WITH SAFETY CHECK)
+    int fileSize = 0;
+    unsigned char *fontFileData = LoadFileData(CN_FONT_PATH, &fileSize);
+
+    if (fontFileData != NULL && codepointCount > 0)
+    {
+        font->baseSize = 64;
+        font->glyphPadding = 4;
+
+        GlyphInfo *glyphs = LoadFontData(fontFileData, fileSize, font->baseSize,
+                                         codepoints, codepointCount,
+                                         FONT_DEFAULT);
+
+        if (glyphs == NULL)
+        {
+            TraceLog(LOG_ERROR, "Failed to load Chinese glyphs, using default font");
+        }
+        else
+        {
+            font->glyphs = glyphs;
+            font->glyphCount = codepointCount;
+
+            // Generate the texture atlas (the actual image of the letters)
+            *atlas = GenImageFontAtlas(font->glyphs, &font->recs,
+                                       codepointCount, font->baseSize, 4, 0);
+        }
+
+        UnloadFileData(fontFileData); // free the raw file data
+    }
+    else
+    {
+        TraceLog(LOG_ERROR, "Chinese font file missing, using default font");
+    }
+
+    if (codepoints != NULL)
+        UnloadCodepoints(codepoints);
+}
+
+// --- LOADER JOBS ---
+// Glyph rasterization and atlas packing run on the loader threads, the
+// atlas texture is created in UploadFont() on the main thread.
+
+// fontEN: what LoadFontFromMemory() does, minus the upload
+static void DecodeFontEN(LoadJob *job)
+{
+    int size = 0;
+    unsigned char *owned = nullptr;
+    const unsigned char *data = ReadAssetData(job->name, &size, &owned);
+    if (data == nullptr)
+        return;
+
+    Font &font = job->font;
+    font.baseSize = 64;
+    font.glyphCount = 95; // ASCII 32..126
+    font.glyphPadding = 4;
+    font.glyphs = LoadFontData(data, size, font.baseSize, NULL, 0, FONT_DEFAULT);
+    if (font.glyphs != nullptr)
+        job->image = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount,
+                                       font.baseSize, font.glyphPadding, 0);
+
+    if (owned != nullptr)
+        UnloadFileData(owned);
+}
+
+// fontCN: the baked atlas, else the TTF bytes for the lazy font, else the
+// whole dialogue rasterized up front
+static void DecodeFontCN(LoadJob *job)
+{
+    PROFILE_ZONE("BuildFontCN");
+
+    int size = 0;
+    unsigned char *owned = nullptr;
+    const unsigned char *data = ReadAssetData("fontCN.atlas", &size, &owned);
+
+    Image atlas;
+    if (data != nullptr && ParseBakedFont(data, size, &job->font, &atlas))
+    {
+        // The source buffer may be gone by upload time
+        job->image = ImageCopy(atlas);
+        if (owned != nullptr)
+            UnloadFileData(owned);
+        return;
+    }
+    if (owned != nullptr)
+        UnloadFileData(owned);
+
+    if (LAZY_CN_FONT)
+    {
+        job->bytes = LoadFileData(CN_FONT_PATH, &job->byteCount);
+        if (job->bytes != nullptr)
+            return;
+    }
+
+    RasterizeFontCN(&job->font, &job->image);
+}
+
+static void UploadFont(LoadJob *job)
+{
+    Font *target = (Font *)job->target;
+
+    // Lazy CN font, glyphs come later
+    if (job->bytes != nullptr)
+    {
+        // 2048x2048 holds ~780 CJK glyphs at 64px; older ones get evicted after that
+        if (lazyFontCN.LoadFromMemory(job->bytes, job->byteCount, 64, 2048, 1024))
+        {
+            TraceLog(LOG_INFO, "No baked Chinese font, rasterizing glyphs on first use");
+            *target = lazyFontCN.font;
+            return;
+        }
+    }
+
+    Font font = job->font;
+    if (job->image.data != nullptr)
+    {
+        font.texture = LoadTextureFromImage(job->image);
+        UnloadImage(job->image);
+    }
+
+    if (font.texture.id == 0)
+    {
+        TraceLog(LOG_WARNING, "%s failed to load, using default font", job->name);
+        UnloadFont(font);
+        font = GetFontDefault();
+    }
+    *target = font;
+}
+
+void LoadGameFonts()
+{
+    // Both fonts are on the menu, so they go to the front of the queue
+    LoadJob job = {};
+    job.decode = DecodeFontEN;
+    job.upload = UploadFont;
+    job.name = "determination-mono.otf";
+    job.target = &fontEN;
+    QueueLoadJob(job);
+
+    job.decode = DecodeFontCN;
+    job.name = "fontCN";
+    job.target = &fontCN;
+    QueueLoadJob(job);
+}
+
+bool AreGameFontsLoaded()
+{
+    return fontEN.texture.id != 0 && fontCN.texture.id != 0;
+}
+
+void UnloadGameFonts()
+{
+    ClearGlyphCache();
+    ClearTextLayoutCache();
+    UnloadFont(fontEN);
+    if (lazyFontCN.Owns(fontCN))
+        lazyFontCN.Unload();
+    else
+        UnloadFont(fontCN);
+}
@@ -0,0 +1,29 @@
+#ifndef FONTS_H
+#define FONTS_H
+
+#include "raylib.h"
+
+// Queues fontEN and fontCN on the asset loader (see AssetLoader.h). fontCN
+// comes from the build-time baked atlas (fontCN.atlas) when present, otherwise
+// from the TTF: lazily, glyph by glyph as they are first used (LAZY_CN_FONT),
+// or all up front.
+void LoadGameFonts();
+void UnloadGameFonts();
+
+// Both fonts are uploaded and safe to draw/measure with
+bool AreGameFontsLoaded();
+
+// MeasureTextEx() that first makes sure a lazy font has the glyphs resident.
+// Use this instead of MeasureTextEx() in game code.
+Vector2 MeasureGameText(Font font, const char *text, float fontSize, float spacing);
+
+// Loads a .atlas file written by tools/FontBaker (one texture upload).
+// Returns a font with texture.id == 0 if the file is missing or invalid.
+Font LoadBakedFont(const char *fileName);
+Font LoadBakedFontFromMemory(const unsigned char *data, int dataSize);
+
+// Fills the glyph tables and points *atlas at the pixels inside data; no GPU
+// work, so it can run on a loader thread (or without a window at all)
+bool ParseBakedFont(const unsigned char *data, int dataSize, Font *out, Image *atlas);
+
+#endif
@@ -1,4 +1,9 @@
 #include "Globals.h"
+#include "AssetPack.h"
+#include "AssetLoader.h"
+#include "MusicThread.h"
+#include "Profiler.h"
+#include "Strings.h"
 #include <cstdio>
 
 Texture2D texBackground;
@@ -21,30 +26,109 @@ Language currentLanguage = LANG_EN;
 Font fontEN;
 Font fontCN;
 
+// --- ASSET LOADERS ---
+// Read from the memory-mapped asset pack when there is one, from
+// assets/<name> otherwise. Textures and sounds are decoded on the loader's
+// worker threads; only the upload happens on the main thread.
+
+static void DecodeImage(LoadJob *job)
+{
+    int size = 0;
+    unsigned char *owned = nullptr;
+    const unsigned char *data = ReadAssetData(job->name, &size, &owned);
+    if (data != nullptr)
+        job->image = LoadImageFromMemory(GetFileExtension(job->name), data, size);
+    if (owned != nullptr)
+        UnloadFileData(owned);
+}
+
+static void UploadTexture(LoadJob *job)
+{
+    *(Texture2D *)job->target = LoadTextureFromImage(job->image);
+    UnloadImage(job->image);
+}
+
+static void DecodeWave(LoadJob *job)
+{
+    int size = 0;
+    unsigned char *owned = nullptr;
+    const unsigned char *data = ReadAssetData(job->name, &size, &owned);
+    if (data != nullptr)
+        job->wave = LoadWaveFromMemory(GetFileExtension(job->name), data, size);
+    if (owned != nullptr)
+        UnloadFileData(owned);
+}
+
+static void UploadSound(LoadJob *job)
+{
+    *(Sound *)job->target = LoadSoundFromWave(job->wave);
+    UnloadWave(job->wave);
+}
+
+static void QueueTexture(const char *name, Texture2D *target)
+{
+    LoadJob job = {};
+    job.decode = DecodeImage;
+    job.upload = UploadTexture;
+    job.name = name;
+    job.target = target;
+    QueueLoadJob(job);
+}
+
+static void QueueSound(const char *name, Sound *target)
+{
+    LoadJob job = {};
+    job.decode = DecodeWave;
+    job.upload = UploadSound;
+    job.name = name;
+    job.target = target;
+    QueueLoadJob(job);
+}
+
+// Streams decode as they play, so opening one is cheap and stays on the main
+// thread. The stream keeps reading from the mapping, so the pack stays open
+// until UnloadGameAssets()
+static Music LoadMusicAsset(const char *name)
+{
+    int size = 0;
+    const unsigned char *data = GetPackedAsset(name, &size);
+    if (data == nullptr)
+        return LoadMusicStream(TextFormat("assets/%s", name));
+
+    return LoadMusicStreamFromMemory(GetFileExtension(name), data, size);
+}
+
 void LoadGameAssets()
 {
-    // Graphics
-    texBackground = LoadTexture("assets/background.png");
-    texPlayer = LoadTexture("assets/heart.png");
-    texRobot = LoadTexture("assets/robot.png");
+    PROFILE_ZONE("LoadGameAssets");
 
-    // Audio
-    sndText = LoadSound("assets/text.wav");
-    sndHurt = LoadSound("assets/hurt.wav");
-    sndSelect = LoadSound("assets/select.wav");
+    if (!OpenAssetPack("assets.pack"))
+        TraceLog(LOG_INFO, "No assets.pack, loading loose files from assets/");
 
-    char buffer[64];
+    // Audio (menu sound first, the menu is up before loading finishes)
+    QueueSound("select.wav", &sndSelect);
+    QueueSound("text.wav", &sndText);
+    QueueSound("hurt.wav", &sndHurt);
+
+    // Names must outlive the jobs
+    static const char *dialupNames[6] = {"dialup0.wav", "dialup1.wav", "dialup2.wav",
+                                         "dialup3.wav", "dialup4.wav", "dialup5.wav"};
     for (int i = 0; i < 6; i++)
-    {
-        sprintf(buffer, "assets/dialup%d.wav", i);
-        sndDialup[i] = LoadSound(buffer);
-    }
+        QueueSound(dialupNames[i], &sndDialup[i]);
+
+    // Graphics
+    QueueTexture("background.png", &texBackground);
+    QueueTexture("heart.png", &texPlayer);
+    QueueTexture("robot.png", &texRobot);
 
     gameFont = GetFontDefault(); // Uses default raylib font
 
-    battleBGMusic = LoadMusicStream("assets/battleBGMusic.ogg");
-    gameOver = LoadMusicStream("assets/gameOver.ogg");
-    menuMusic = LoadMusicStream("assets/menu.ogg");
+    // Buffers sized for the music thread's refill rate (see MusicThread.h)
+    SetAudioStreamBufferSizeDefault(MUSIC_BUFFER_FRAMES);
+    battleBGMusic = LoadMusicAsset("battleBGMusic.ogg");
+    gameOver = LoadMusicAsset("gameOver.ogg");
+    menuMusic = LoadMusicAsset("menu.ogg");
+    SetAudioStreamBufferSizeDefault(0);
 
     // loop the music when it reaches the end
     battleBGMusic.looping = true;
@@ -67,6 +151,10 @@ void UnloadGameAssets()
     UnloadMusicStream(battleBGMusic);
     UnloadMusicStream(gameOver);
     UnloadMusicStream(menuMusic);
+
+    // The catalog may be a slice of the pack
+    UnloadStringCatalog();
+    CloseAssetPack();
 }
 
 Font GetCurrentFont()
@@ -76,9 +164,8 @@ Font GetCurrentFont()
     return fontEN;
 }
 
-const char *Text(const char *en, const char *cn)
+void SetLanguage(Language lang)
 {
-    if (currentLanguage == LANG_CN)
-        return cn;
-    return en;
+    currentLanguage = lang;
+    SelectStringLanguage(lang);
 }
\ No newline at end of file
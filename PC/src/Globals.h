@@ -32,10 +32,11 @@ extern Font fontCN;
 // Helper to get the correct font based on current settings
 Font GetCurrentFont();
 
-// Helper to pick text based on language
-const char *Text(const char *en, const char *cn);
+// Switches the game's text (see Strings.h) and currentLanguage together
+void SetLanguage(Language lang);
 
-// Functions to load/unload
+// Functions to load/unload. LoadGameAssets() opens the music streams and
+// queues everything else on the asset loader (see AssetLoader.h).
 void LoadGameAssets();
 void UnloadGameAssets();
 
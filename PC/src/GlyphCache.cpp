@@ -0,0 +1,41 @@
+#include "GlyphCache.h"
+#include "DynamicFont.h"
+#include <unordered_map>
+#include <cstdint>
+
+static std::unordered_map<uint64_t, float> glyphAdvances;
+
+// Packs texture id (23 bits), size in 1/64 px (20 bits) and codepoint (21 bits)
+static uint64_t MakeGlyphKey(Font font, float fontSize, int codepoint)
+{
+    uint64_t fontKey = (uint64_t)(font.texture.id & 0x7FFFFF);
+    uint64_t sizeKey = (uint64_t)((int)(fontSize * 64.0f + 0.5f) & 0xFFFFF);
+    uint64_t cpKey = (uint64_t)(codepoint & 0x1FFFFF);
+    return (fontKey << 41) | (sizeKey << 21) | cpKey;
+}
+
+float GetGlyphAdvance(Font font, float fontSize, int codepoint)
+{
+    uint64_t key = MakeGlyphKey(font, fontSize, codepoint);
+
+    auto it = glyphAdvances.find(key);
+    if (it != glyphAdvances.end())
+        return it->second;
+
+    // First time we see it: measure once, same as the old per-character path
+    int byteCount = 0;
+    const char *utf8 = CodepointToUTF8(codepoint, &byteCount);
+    char tempStr[5] = {0};
+    for (int b = 0; b < byteCount && b < 4; b++)
+        tempStr[b] = utf8[b];
+
+    EnsureFontGlyph(font, codepoint);
+    float advance = MeasureTextEx(font, tempStr, fontSize, 0.0f).x;
+    glyphAdvances[key] = advance;
+    return advance;
+}
+
+void ClearGlyphCache()
+{
+    glyphAdvances.clear();
+}
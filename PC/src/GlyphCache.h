@@ -0,0 +1,14 @@
+#ifndef GLYPH_CACHE_H
+#define GLYPH_CACHE_H
+
+#include "raylib.h"
+
+// --- GLYPH METRICS CACHE ---
+// Horizontal advance of a single codepoint, keyed by font, size and codepoint.
+// Equal to MeasureTextEx() on that one character, so spacing is not included.
+float GetGlyphAdvance(Font font, float fontSize, int codepoint);
+
+// Call after a font is unloaded/reloaded (texture ids can be reused)
+void ClearGlyphCache();
+
+#endif
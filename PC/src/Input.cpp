@@ -0,0 +1,115 @@
+#include "Input.h"
+#include "Sim.h"
+#include "Render.h"
+#include "raylib.h"
+
+// Covers every raylib KeyboardKey value (the highest is KEY_KB_MENU = 348)
+#define VIRTUAL_KEY_COUNT 512
+
+static bool virtualDown[VIRTUAL_KEY_COUNT];
+static bool virtualWasDown[VIRTUAL_KEY_COUNT];
+
+// Windowed: pressed since the last tick, and what the current tick sees
+static bool pendingPressed[VIRTUAL_KEY_COUNT];
+static bool tickPressed[VIRTUAL_KEY_COUNT];
+
+// Every key gameplay asks about; a recording stores one down bit and one
+// pressed bit per entry, so new keys go at the end
+static const int recordedKeys[] = {
+    KEY_Z, KEY_ENTER, KEY_X, KEY_LEFT_SHIFT,
+    KEY_LEFT, KEY_RIGHT, KEY_UP, KEY_DOWN,
+    KEY_A, KEY_D, KEY_ONE, KEY_TWO};
+#define RECORDED_KEY_COUNT ((int)(sizeof(recordedKeys) / sizeof(recordedKeys[0])))
+#define PRESSED_SHIFT 16
+static_assert(RECORDED_KEY_COUNT <= PRESSED_SHIFT, "recorded keys fit in 16 bits");
+
+static bool injected = false;
+static uint32_t injectedKeys = 0;
+
+static uint32_t InjectedBit(int key, int shift)
+{
+    for (int i = 0; i < RECORDED_KEY_COUNT; i++)
+    {
+        if (recordedKeys[i] == key)
+            return (injectedKeys >> (i + shift)) & 1;
+    }
+    return 0;
+}
+
+bool IsGameKeyPressed(int key)
+{
+    if (key < 0 || key >= VIRTUAL_KEY_COUNT)
+        return false;
+    if (injected)
+        return InjectedBit(key, PRESSED_SHIFT) != 0;
+    if (!simConfig.headless)
+        return tickPressed[key];
+
+    // Same edge semantics as raylib: down this tick, up the tick before
+    return virtualDown[key] && !virtualWasDown[key];
+}
+
+bool IsGameKeyDown(int key)
+{
+    if (injected)
+        return InjectedBit(key, 0) != 0;
+    if (!simConfig.headless)
+        return IsKeyDown(key);
+
+    if (key < 0 || key >= VIRTUAL_KEY_COUNT)
+        return false;
+    return virtualDown[key];
+}
+
+void PollInput()
+{
+    for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed())
+    {
+        if (key < VIRTUAL_KEY_COUNT)
+            pendingPressed[key] = true;
+        MarkFrameDirty();
+    }
+}
+
+void BeginInputTick()
+{
+    injected = false;
+    if (!simConfig.headless)
+    {
+        for (int i = 0; i < VIRTUAL_KEY_COUNT; i++)
+        {
+            tickPressed[i] = pendingPressed[i];
+            pendingPressed[i] = false;
+        }
+        return;
+    }
+
+    for (int i = 0; i < VIRTUAL_KEY_COUNT; i++)
+        virtualWasDown[i] = virtualDown[i];
+}
+
+void SetVirtualKey(int key, bool down)
+{
+    if (key < 0 || key >= VIRTUAL_KEY_COUNT)
+        return;
+    virtualDown[key] = down;
+}
+
+uint32_t CaptureInputTick()
+{
+    uint32_t keys = 0;
+    for (int i = 0; i < RECORDED_KEY_COUNT; i++)
+    {
+        if (IsGameKeyDown(recordedKeys[i]))
+            keys |= 1u << i;
+        if (IsGameKeyPressed(recordedKeys[i]))
+            keys |= 1u << (i + PRESSED_SHIFT);
+    }
+    return keys;
+}
+
+void InjectInputTick(uint32_t keys)
+{
+    injected = true;
+    injectedKeys = keys;
+}
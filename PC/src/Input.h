@@ -0,0 +1,27 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+
+// --- KEYBOARD ---
+// Gameplay code asks these instead of raylib's IsKeyPressed/IsKeyDown.
+// In a windowed run presses are latched per frame and handed to the next
+// tick, so a frame that runs two ticks doesn't see a press twice and one
+// that runs none doesn't lose it. In a headless run the keys come from a
+// virtual keyboard that the autopilot drives.
+bool IsGameKeyPressed(int key);
+bool IsGameKeyDown(int key);
+
+void PollInput();      // Windowed: call once per frame, after raylib polled events
+void BeginInputTick(); // Call once per tick, before the autopilot sets keys
+
+// Virtual keyboard (headless only)
+void SetVirtualKey(int key, bool down);
+
+// Everything the current tick sees of the keys gameplay asks about, packed
+// for input recordings (see Replay.h). Injecting makes the rest of the tick
+// see the packed keys instead of the keyboard or autopilot.
+uint32_t CaptureInputTick();
+void InjectInputTick(uint32_t keys);
+
+#endif
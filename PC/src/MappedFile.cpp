@@ -0,0 +1,88 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+bool MapFile(const char *fileName, MappedFile *file)
+{
+    HANDLE fh = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fh == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(fh);
+        return false;
+    }
+
+    HANDLE mh = CreateFileMappingA(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mh == NULL)
+    {
+        CloseHandle(fh);
+        return false;
+    }
+
+    void *view = MapViewOfFile(mh, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL)
+    {
+        CloseHandle(mh);
+        CloseHandle(fh);
+        return false;
+    }
+
+    file->data = (const unsigned char *)view;
+    file->size = (size_t)size.QuadPart;
+    file->fileHandle = fh;
+    file->mapHandle = mh;
+    return true;
+}
+
+void UnmapFile(MappedFile *file)
+{
+    if (file->data != nullptr)
+        UnmapViewOfFile(file->data);
+    if (file->mapHandle != nullptr)
+        CloseHandle((HANDLE)file->mapHandle);
+    if (file->fileHandle != nullptr)
+        CloseHandle((HANDLE)file->fileHandle);
+    *file = MappedFile();
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool MapFile(const char *fileName, MappedFile *file)
+{
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    void *view = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file alive
+    if (view == MAP_FAILED)
+        return false;
+
+    file->data = (const unsigned char *)view;
+    file->size = (size_t)st.st_size;
+    return true;
+}
+
+void UnmapFile(MappedFile *file)
+{
+    if (file->data != nullptr)
+        munmap((void *)file->data, file->size);
+    *file = MappedFile();
+}
+#endif
@@ -0,0 +1,19 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+
+// --- READ-ONLY MEMORY-MAPPED FILE ---
+// Kept out of raylib headers on purpose: windows.h and raylib.h clash.
+struct MappedFile
+{
+    const unsigned char *data = nullptr;
+    size_t size = 0;
+    void *fileHandle = nullptr; // Windows only
+    void *mapHandle = nullptr;  // Windows only
+};
+
+bool MapFile(const char *fileName, MappedFile *file);
+void UnmapFile(MappedFile *file);
+
+#endif
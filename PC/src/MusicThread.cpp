@@ -0,0 +1,154 @@
+#include "MusicThread.h"
+#include "Globals.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+// How often the thread wakes to refill, well inside one sub-buffer
+#define MUSIC_REFILL_MS 5
+
+enum MusicCommandType
+{
+    MUSIC_CMD_PLAY,
+    MUSIC_CMD_STOP,
+    MUSIC_CMD_VOLUME
+};
+
+struct MusicCommand
+{
+    MusicCommandType type;
+    MusicTrack track;
+    float volume;
+};
+
+// Single producer (gameplay), single consumer (the music thread). head is
+// only written by the consumer, tail only by the producer.
+#define MUSIC_QUEUE_SIZE 32 // Power of two
+static MusicCommand queue[MUSIC_QUEUE_SIZE];
+static std::atomic<unsigned int> queueHead{0};
+static std::atomic<unsigned int> queueTail{0};
+
+static Music *const tracks[MUSIC_TRACK_COUNT] = {&menuMusic, &battleBGMusic, &gameOver};
+
+static std::thread musicThread;
+static std::atomic<bool> running{false};
+static std::atomic<int> underrunCount{0};
+
+// Producer side view, so gameplay sees its own requests immediately
+static bool requestedPlaying[MUSIC_TRACK_COUNT];
+
+static void PushCommand(MusicCommandType type, MusicTrack track, float volume)
+{
+    if (!running.load(std::memory_order_relaxed))
+        return;
+
+    unsigned int tail = queueTail.load(std::memory_order_relaxed);
+    // Full only if gameplay posts 32 commands within one refill; wait it out
+    while (tail - queueHead.load(std::memory_order_acquire) >= MUSIC_QUEUE_SIZE)
+        std::this_thread::yield();
+
+    queue[tail & (MUSIC_QUEUE_SIZE - 1)] = {type, track, volume};
+    queueTail.store(tail + 1, std::memory_order_release);
+}
+
+static void MusicLoop()
+{
+    bool playing[MUSIC_TRACK_COUNT] = {};
+    auto lastRefill = std::chrono::steady_clock::now();
+
+    while (running.load(std::memory_order_acquire))
+    {
+        unsigned int head = queueHead.load(std::memory_order_relaxed);
+        unsigned int tail = queueTail.load(std::memory_order_acquire);
+        for (; head != tail; head++)
+        {
+            const MusicCommand &cmd = queue[head & (MUSIC_QUEUE_SIZE - 1)];
+            Music &music = *tracks[cmd.track];
+            switch (cmd.type)
+            {
+            case MUSIC_CMD_PLAY:
+                PlayMusicStream(music);
+                playing[cmd.track] = true;
+                break;
+            case MUSIC_CMD_STOP:
+                StopMusicStream(music);
+                playing[cmd.track] = false;
+                break;
+            case MUSIC_CMD_VOLUME:
+                SetMusicVolume(music, cmd.volume);
+                break;
+            }
+        }
+        queueHead.store(head, std::memory_order_release);
+
+        // The OS can still oversleep; if the gap outlasted both sub-buffers
+        // of a playing stream, the device ran dry
+        auto now = std::chrono::steady_clock::now();
+        double gap = std::chrono::duration<double>(now - lastRefill).count();
+        lastRefill = now;
+
+        for (int i = 0; i < MUSIC_TRACK_COUNT; i++)
+        {
+            if (!playing[i])
+                continue;
+
+            Music &music = *tracks[i];
+            if (music.stream.sampleRate > 0 && gap > 2.0 * MUSIC_BUFFER_FRAMES / music.stream.sampleRate)
+                underrunCount.fetch_add(1, std::memory_order_relaxed);
+            UpdateMusicStream(music);
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(MUSIC_REFILL_MS));
+    }
+
+    for (int i = 0; i < MUSIC_TRACK_COUNT; i++)
+    {
+        if (playing[i])
+            StopMusicStream(*tracks[i]);
+    }
+}
+
+void StartMusicThread()
+{
+    if (running)
+        return;
+    running = true;
+    musicThread = std::thread(MusicLoop);
+}
+
+void StopMusicThread()
+{
+    if (!running)
+        return;
+    running = false;
+    musicThread.join();
+
+    TraceLog(LOG_INFO, "AUDIO: %d music underruns", GetMusicUnderrunCount());
+}
+
+void PlayMusic(MusicTrack track)
+{
+    requestedPlaying[track] = true;
+    PushCommand(MUSIC_CMD_PLAY, track, 0.0f);
+}
+
+void StopMusic(MusicTrack track)
+{
+    requestedPlaying[track] = false;
+    PushCommand(MUSIC_CMD_STOP, track, 0.0f);
+}
+
+void SetMusicTrackVolume(MusicTrack track, float volume)
+{
+    PushCommand(MUSIC_CMD_VOLUME, track, volume);
+}
+
+bool IsMusicPlaying(MusicTrack track)
+{
+    return requestedPlaying[track];
+}
+
+int GetMusicUnderrunCount()
+{
+    return underrunCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,37 @@
+#ifndef MUSIC_THREAD_H
+#define MUSIC_THREAD_H
+
+// --- MUSIC STREAMING ---
+// The music streams are refilled on their own thread every few milliseconds,
+// so a slow frame (asset upload, font build, a debugger pause) can't starve
+// them. Gameplay never touches the streams: it posts play/stop/volume
+// commands through a lock-free single-producer queue that the thread drains
+// before each refill. Main thread only, like the rest of gameplay.
+enum MusicTrack
+{
+    MUSIC_MENU,
+    MUSIC_BATTLE,
+    MUSIC_GAME_OVER,
+    MUSIC_TRACK_COUNT
+};
+
+// Frames per stream sub-buffer (raylib keeps two). Set before the streams
+// are opened; a refill gap longer than both buffers is an underrun.
+#define MUSIC_BUFFER_FRAMES 4096
+
+// After LoadGameAssets() / before UnloadGameAssets(). Without a running
+// thread (headless) commands only update what IsMusicPlaying() reports.
+void StartMusicThread();
+void StopMusicThread();
+
+void PlayMusic(MusicTrack track);
+void StopMusic(MusicTrack track);
+void SetMusicTrackVolume(MusicTrack track, float volume);
+
+// What gameplay last asked for, not whether the thread got to it yet
+bool IsMusicPlaying(MusicTrack track);
+
+// Refill gaps long enough for a playing stream to have run dry
+int GetMusicUnderrunCount();
+
+#endif
@@ -0,0 +1,136 @@
+#include "PerfHud.h"
+#include "Globals.h"
+#include "Battle.h"
+#include "Dialogue.h"
+#include "Render.h"
+#include "Sim.h"
+#include "MusicThread.h"
+#include <cmath>
+
+// Defined in main.cpp
+extern int currentDialogueNode;
+
+#define PERF_HUD_KEY KEY_F3
+#define PERF_HISTORY 120 // Frames in the graph, two seconds at 60 Hz
+
+static bool visible = false;
+static PerfFrame history[PERF_HISTORY];
+static int historyNext = 0; // Oldest sample, overwritten next
+
+void UpdatePerfHud()
+{
+    // Read straight from raylib: a debug key isn't game input, so it isn't
+    // latched into ticks or written to input recordings
+    if (IsKeyPressed(PERF_HUD_KEY))
+    {
+        visible = !visible;
+        MarkFrameDirty();
+    }
+}
+
+bool IsPerfHudVisible()
+{
+    return visible;
+}
+
+void RecordPerfFrame(const PerfFrame &frame)
+{
+    history[historyNext] = frame;
+    historyNext = (historyNext + 1) % PERF_HISTORY;
+}
+
+static long long TextureBytes(Texture2D texture)
+{
+    if (texture.id == 0)
+        return 0;
+    return GetPixelDataSize(texture.width, texture.height, texture.format);
+}
+
+// As the device plays it, not as the file stores it
+static long long SoundBytes(Sound sound)
+{
+    return (long long)sound.frameCount * sound.stream.channels * sound.stream.sampleSize / 8;
+}
+
+// A music stream only holds its two sub-buffers decoded
+static long long MusicBytes(Music music)
+{
+    return 2LL * MUSIC_BUFFER_FRAMES * music.stream.channels * music.stream.sampleSize / 8;
+}
+
+static const char *PhaseName(BattlePhase phase)
+{
+    static const char *names[] = {"B_INIT", "B_INTRO", "B_SETUP", "B_WAIT", "B_RESULT", "B_RESPONSE", "B_VICTORY", "B_GAMEOVER_PHASE"};
+    return names[phase];
+}
+
+void DrawPerfHud()
+{
+    if (!visible)
+        return;
+
+    static const char *stateNames[GAME_STATE_COUNT] = {"MENU", "MAP_WALK", "DIALOGUE", "BATTLE", "GAME_OVER"};
+    const int fontSize = 20;
+    const int lineHeight = 22;
+    const int x = 10;
+    const int width = 2 * PERF_HISTORY + 20;
+    const int graphHeight = 80;
+    const float budgetMs = simConfig.fixedDt * 1000.0f;
+
+    DrawRectangle(0, 0, width + 2 * x, graphHeight + 9 * lineHeight + 30, Fade(BLACK, 0.75f));
+
+    // Frame graph: each column is one frame, update (green) under draw
+    // (blue), the rest of the frame (waiting for the next tick) grey. The
+    // line is one tick; two ticks is the top.
+    const int graphTop = 10;
+    const float msToPx = graphHeight / (2.0f * budgetMs);
+    for (int i = 0; i < PERF_HISTORY; i++)
+    {
+        const PerfFrame &f = history[(historyNext + i) % PERF_HISTORY];
+        int bx = x + 2 * i;
+        int bottom = graphTop + graphHeight;
+        int frameH = (int)fminf(f.frameMs * msToPx, (float)graphHeight);
+        int updateH = (int)fminf(f.updateMs * msToPx, (float)graphHeight);
+        int drawH = (int)fminf(f.drawMs * msToPx, (float)(graphHeight - updateH));
+
+        DrawRectangle(bx, bottom - frameH, 2, frameH, f.frameMs > 1.5f * budgetMs ? RED : DARKGRAY);
+        DrawRectangle(bx, bottom - updateH, 2, updateH, GREEN);
+        DrawRectangle(bx, bottom - updateH - drawH, 2, drawH, SKYBLUE);
+    }
+    int budgetY = graphTop + graphHeight - (int)(budgetMs * msToPx);
+    DrawLine(x, budgetY, x + 2 * PERF_HISTORY, budgetY, YELLOW);
+
+    const PerfFrame &last = history[(historyNext + PERF_HISTORY - 1) % PERF_HISTORY];
+    float worstMs = 0.0f;
+    for (const PerfFrame &f : history)
+        worstMs = fmaxf(worstMs, f.frameMs);
+
+    long long texBytes = TextureBytes(texBackground) + TextureBytes(texPlayer) + TextureBytes(texRobot) +
+                         TextureBytes(fontEN.texture) + TextureBytes(fontCN.texture) +
+                         TextureBytes(raylibRenderer.frameTarget.texture) + raylibRenderer.layerBytes;
+    long long soundBytes = SoundBytes(sndText) + SoundBytes(sndHurt) + SoundBytes(sndSelect) +
+                           MusicBytes(menuMusic) + MusicBytes(battleBGMusic) + MusicBytes(gameOver);
+    for (const Sound &s : sndDialup)
+        soundBytes += SoundBytes(s);
+
+    const DialogueNode *node = GetDialogueNode(currentDialogueNode);
+
+    int y = graphTop + graphHeight + 10;
+    DrawText(TextFormat("frame %5.2f ms  worst %5.2f", last.frameMs, worstMs), x, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("update %5.2f ms  draw %5.2f", last.updateMs, last.drawMs), x, y, fontSize, GREEN);
+    y += lineHeight;
+    DrawText(TextFormat("ticks %d  drawn %d", last.ticks, last.drawnTicks), x, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("draws %d  glyphs %d", raylibRenderer.drawCalls, raylibRenderer.glyphs), x, y, fontSize, SKYBLUE);
+    y += lineHeight;
+    DrawText(TextFormat("allocs/frame %lld", last.allocations), x, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("tex %.1f MB  snd %.1f MB", texBytes / 1048576.0, soundBytes / 1048576.0), x, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("music underruns %d", GetMusicUnderrunCount()), x, y, fontSize, WHITE);
+    y += lineHeight;
+    DrawText(TextFormat("%s  %s", stateNames[currentState], PhaseName(battlePhase)), x, y, fontSize, YELLOW);
+    y += lineHeight;
+    DrawText(TextFormat("node %d %s", currentDialogueNode, node != nullptr ? node->name : "-"), x, y, fontSize, YELLOW);
+}
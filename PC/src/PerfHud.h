@@ -0,0 +1,34 @@
+#ifndef PERF_HUD_H
+#define PERF_HUD_H
+
+// --- PERFORMANCE HUD ---
+// F3 shows an overlay with the last few seconds of frame times and what the
+// current frame cost: tick (update, which also submits the draws) vs draw
+// (flushing the game frame and presenting it), draw calls and glyphs sent to
+// raylib, heap allocations, texture and sound memory, and where the game is
+// (GameState, dialogue node, BattlePhase). It is drawn with raylib directly,
+// after the game frame is blitted, so it never shows up in recordings or in
+// its own counters. Window only.
+
+// Timings of one window frame, in milliseconds
+struct PerfFrame
+{
+    float frameMs;  // Start of the frame to the end of its wait for the next
+    float updateMs; // Inside the state handlers, all ticks
+    float drawMs;   // Flushing the game frame(s) and presenting
+    int ticks;      // Ticks run this frame
+    int drawnTicks; // Of those, ones that drew (see MarkFrameDirty())
+    long long allocations;
+};
+
+// Toggles on F3. Call once per frame after PollInput().
+void UpdatePerfHud();
+bool IsPerfHudVisible();
+
+// Adds a frame to the graph
+void RecordPerfFrame(const PerfFrame &frame);
+
+// Between BeginDrawing() and EndDrawing(), after the game frame
+void DrawPerfHud();
+
+#endif
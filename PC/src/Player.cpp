@@ -1,17 +1,33 @@
 #include "Player.h"
 #include "Globals.h"
+#include "Input.h"
+#include "Render.h"
+#include "Sim.h"
 
 Player player;
 
 void Player::Init(int startX, int startY)
 {
-    pos = {(float)startX, (float)startY};
+    SnapTo({(float)startX, (float)startY});
     hp = PLAYER_MAX_HP;
 }
 
+void Player::SnapTo(Vector2 newPos)
+{
+    pos = newPos;
+    prevPos = newPos;
+}
+
 void Player::SetZones(const std::vector<Rect> &newZones)
 {
     zones = newZones;
+    walkMask.Build(zones);
+}
+
+void Player::SetZones(const std::vector<Rect> &newZones, const CollisionMask &mask)
+{
+    zones = newZones;
+    walkMask = mask;
 }
 
 bool Player::CheckCollision(Vector2 nextPos, int w, int h)
@@ -24,30 +40,24 @@ bool Player::CheckCollision(Vector2 nextPos, int w, int h)
     int feetX = (int)nextPos.x + (w / 2);
     int feetY = (int)nextPos.y + h;
 
-    for (const auto &box : zones)
-    {
-        if (feetX >= box.x && feetX <= box.x + box.w &&
-            feetY >= box.y && feetY <= box.y + box.h)
-        {
-            return true;
-        }
-    }
-    return false;
+    return walkMask.Test(feetX, feetY);
 }
 
 void Player::Update(float dt, NPC *enemy)
 {
     // 1. Save where we were BEFORE moving
     Vector2 originalPos = pos;
+    prevPos = pos;
+    movedTick = simTick;
     Vector2 nextPos = pos;
 
-    if (IsKeyDown(KEY_LEFT))
+    if (IsGameKeyDown(KEY_LEFT))
         nextPos.x -= speed * dt;
-    if (IsKeyDown(KEY_RIGHT))
+    if (IsGameKeyDown(KEY_RIGHT))
         nextPos.x += speed * dt;
-    if (IsKeyDown(KEY_UP))
+    if (IsGameKeyDown(KEY_UP))
         nextPos.y -= speed * dt;
-    if (IsKeyDown(KEY_DOWN))
+    if (IsGameKeyDown(KEY_DOWN))
         nextPos.y += speed * dt;
 
     // Map Walk Collision
@@ -123,10 +133,21 @@ void Player::Update(float dt, NPC *enemy)
 
         pos = nextPos;
     }
+
+    if (pos.x != originalPos.x || pos.y != originalPos.y)
+        MarkFrameDirty();
 }
 
 void Player::Draw()
 {
+    // Between ticks, unless it stood still this tick
+    Vector2 drawPos = pos;
+    if (movedTick == simTick && renderAlpha < 1.0f)
+    {
+        drawPos.x = prevPos.x + (pos.x - prevPos.x) * renderAlpha;
+        drawPos.y = prevPos.y + (pos.y - prevPos.y) * renderAlpha;
+    }
+
     // Draw Texture
-    DrawTexture(texPlayer, (int)pos.x, (int)pos.y, WHITE);
+    GfxDrawTexture(texPlayer, (int)drawPos.x, (int)drawPos.y, WHITE);
 }
\ No newline at end of file
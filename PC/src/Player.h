@@ -2,19 +2,27 @@
 #define PLAYER_CLASS_H
 
 #include "game_defs.h"
+#include "CollisionMask.h"
 
 class Player
 {
 public:
     Vector2 pos;
+    Vector2 prevPos;      // pos before the last Update, for drawing between ticks
+    long movedTick = -1;  // simTick of the last Update
     float speed = 375.0f; // Pixels per second
     int hp;
 
-    // Collision zones
+    // Collision zones, and the same zones as a bit grid for point tests
     std::vector<Rect> zones;
+    CollisionMask walkMask;
 
     void Init(int startX, int startY);
+    // Moves without drawing the in-between positions
+    void SnapTo(Vector2 newPos);
     void SetZones(const std::vector<Rect> &newZones);
+    // Same zones already baked (the map's floor)
+    void SetZones(const std::vector<Rect> &newZones, const CollisionMask &mask);
     void Update(float dt, NPC *enemy = nullptr);
     void Draw();
 
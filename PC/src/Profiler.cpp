@@ -0,0 +1,144 @@
+#include "Profiler.h"
+#include "raylib.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+struct ProfileEvent
+{
+    const char *name;
+    uint64_t start;
+    uint64_t end;
+};
+
+// Written only by its thread; the writer publishes each event by bumping
+// written, so a reader on another thread sees whole events
+struct ProfileRing
+{
+    int tid;
+    const char *threadName;
+    ProfileEvent events[PROFILE_RING_EVENTS];
+    std::atomic<uint64_t> written{0};
+};
+
+static std::atomic<bool> enabled{false};
+static const char *tracePath = nullptr;
+static uint64_t startTime = 0;
+
+// Rings live until the process exits: a thread can finish before the trace
+// is written
+static std::mutex ringsMutex;
+static std::vector<ProfileRing *> rings;
+static thread_local ProfileRing *threadRing = nullptr;
+
+static ProfileRing *GetThreadRing()
+{
+    if (threadRing == nullptr)
+    {
+        ProfileRing *ring = new ProfileRing();
+        ring->threadName = "worker";
+
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        ring->tid = (int)rings.size() + 1;
+        rings.push_back(ring);
+        threadRing = ring;
+    }
+    return threadRing;
+}
+
+uint64_t GetProfilerTime()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void StartProfiler(const char *path)
+{
+    tracePath = path;
+    startTime = GetProfilerTime();
+    enabled = true;
+    SetProfilerThreadName("main");
+}
+
+bool IsProfilerEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void SetProfilerThreadName(const char *name)
+{
+    if (!IsProfilerEnabled())
+        return;
+    GetThreadRing()->threadName = name;
+}
+
+void RecordProfileZone(const char *name, uint64_t start, uint64_t end)
+{
+    ProfileRing *ring = GetThreadRing();
+    uint64_t n = ring->written.load(std::memory_order_relaxed);
+    ring->events[n & (PROFILE_RING_EVENTS - 1)] = {name, start, end};
+    ring->written.store(n + 1, std::memory_order_release);
+}
+
+bool WriteProfileTrace()
+{
+    if (tracePath == nullptr)
+        return false;
+
+    FILE *out = fopen(tracePath, "w");
+    if (out == nullptr)
+    {
+        TraceLog(LOG_ERROR, "PROFILER: cannot write %s", tracePath);
+        return false;
+    }
+
+    std::vector<ProfileRing *> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        snapshot = rings;
+    }
+
+    // ts and dur are microseconds
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    long eventCount = 0;
+    std::vector<ProfileEvent> events;
+    for (size_t r = 0; r < snapshot.size(); r++)
+    {
+        ProfileRing *ring = snapshot[r];
+        fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                r ? ",\n" : "", ring->tid, ring->threadName);
+
+        uint64_t last = ring->written.load(std::memory_order_acquire);
+        uint64_t first = (last > PROFILE_RING_EVENTS) ? last - PROFILE_RING_EVENTS : 0;
+        events.assign(ring->events, ring->events + PROFILE_RING_EVENTS);
+
+        // Anything the thread lapped during the copy is torn
+        uint64_t after = ring->written.load(std::memory_order_acquire);
+        if (after > PROFILE_RING_EVENTS && after - PROFILE_RING_EVENTS > first)
+            first = after - PROFILE_RING_EVENTS;
+
+        for (uint64_t i = first; i < last; i++)
+        {
+            const ProfileEvent &e = events[i & (PROFILE_RING_EVENTS - 1)];
+            fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    e.name, ring->tid, (e.start - startTime) / 1000.0, (e.end - e.start) / 1000.0);
+            eventCount++;
+        }
+    }
+    fprintf(out, "\n]}\n");
+    fclose(out);
+
+    TraceLog(LOG_INFO, "PROFILER: %ld zones on %d threads -> %s", eventCount, (int)snapshot.size(), tracePath);
+    return true;
+}
+
+void StopProfiler()
+{
+    if (!IsProfilerEnabled())
+        return;
+    enabled = false;
+    WriteProfileTrace();
+}
@@ -0,0 +1,55 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+// --- PROFILING ZONES ---
+// PROFILE_ZONE("name") at the top of a scope records when it started and how
+// long it took, on the calling thread. Each thread writes to its own ring
+// buffer (the last PROFILE_RING_EVENTS zones), so recording takes no locks.
+// The buffers are written as a Chrome trace_event JSON file, one row per
+// thread, when the game exits or on F4; open it in chrome://tracing or
+// ui.perfetto.dev. Without --trace <file> a zone is just a flag check.
+//
+// Zone names are kept as pointers: use string literals, or strings that
+// live as long as the game (asset names).
+
+#define PROFILE_RING_EVENTS 65536 // Per thread, power of two
+
+// Before any thread records (before StartAssetLoader()). The calling thread
+// shows up as "main".
+void StartProfiler(const char *path);
+bool IsProfilerEnabled();
+
+// Labels the calling thread's row in the trace
+void SetProfilerThreadName(const char *name);
+
+uint64_t GetProfilerTime(); // Nanoseconds, steady clock
+void RecordProfileZone(const char *name, uint64_t start, uint64_t end);
+
+// Writes everything still in the rings; recording carries on. Zones a thread
+// overwrites while this runs are left out.
+bool WriteProfileTrace();
+
+// Writes the trace and stops recording. After the other threads are joined.
+void StopProfiler();
+
+struct ProfileZone
+{
+    const char *name;
+    uint64_t start;
+
+    explicit ProfileZone(const char *zoneName)
+        : name(zoneName), start(IsProfilerEnabled() ? GetProfilerTime() : 0) {}
+    ~ProfileZone()
+    {
+        if (start != 0)
+            RecordProfileZone(name, start, GetProfilerTime());
+    }
+};
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+
+#endif
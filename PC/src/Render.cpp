@@ -0,0 +1,718 @@
+#include "Render.h"
+#include "Globals.h"
+#include "GlyphCache.h"
+#include "DynamicFont.h"
+#include "rlgl.h"
+#include <cmath>
+
+RaylibRenderer raylibRenderer;
+RecordingRenderer recordingRenderer;
+Renderer *activeRenderer = &raylibRenderer;
+
+// --- DRAW WRAPPERS ---
+// DrawTexture/DrawTextureEx and DrawRectangle are expressed through the Pro/Rec
+// variants, the same way raylib implements them internally.
+
+void GfxClearBackground(Color color)
+{
+    activeRenderer->ClearBackground(color);
+}
+
+void GfxDrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    EnsureFontGlyphs(font, text);
+    activeRenderer->DrawTextEx(font, text, position, fontSize, spacing, tint);
+}
+
+void GfxDrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
+{
+    EnsureFontGlyph(font, codepoint);
+    activeRenderer->DrawTextCodepoint(font, codepoint, position, fontSize, tint);
+}
+
+void GfxDrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    if (lazyFontCN.Owns(font))
+    {
+        for (int i = 0; i < codepointCount; i++)
+            lazyFontCN.EnsureGlyph(codepoints[i]);
+    }
+    activeRenderer->DrawTextCodepoints(font, codepoints, codepointCount, position, fontSize, spacing, tint);
+}
+
+void GfxDrawTexture(Texture2D texture, int posX, int posY, Color tint)
+{
+    GfxDrawTextureEx(texture, {(float)posX, (float)posY}, 0.0f, 1.0f, tint);
+}
+
+void GfxDrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint)
+{
+    Rectangle source = {0.0f, 0.0f, (float)texture.width, (float)texture.height};
+    Rectangle dest = {position.x, position.y, (float)texture.width * scale, (float)texture.height * scale};
+    activeRenderer->DrawTexturePro(texture, source, dest, {0.0f, 0.0f}, rotation, tint);
+}
+
+void GfxDrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    activeRenderer->DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+void GfxDrawRectangle(int posX, int posY, int width, int height, Color color)
+{
+    activeRenderer->DrawRectangleRec({(float)posX, (float)posY, (float)width, (float)height}, color);
+}
+
+void GfxDrawRectangleRec(Rectangle rec, Color color)
+{
+    activeRenderer->DrawRectangleRec(rec, color);
+}
+
+void GfxDrawRectangleLinesEx(Rectangle rec, float lineThick, Color color)
+{
+    activeRenderer->DrawRectangleLinesEx(rec, lineThick, color);
+}
+
+void GfxDrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
+{
+    activeRenderer->DrawRectangleRounded(rec, roundness, segments, color);
+}
+
+void GfxDrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color)
+{
+    activeRenderer->DrawRectangleRoundedLinesEx(rec, roundness, segments, lineThick, color);
+}
+
+void GfxDrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    activeRenderer->DrawTriangle(v1, v2, v3, color);
+}
+
+void GfxDrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
+{
+    activeRenderer->DrawLineEx(startPos, endPos, thick, color);
+}
+
+void GfxDrawGlyphBatch(Font font, const GlyphInstance *glyphs, int count)
+{
+    if (count <= 0)
+        return;
+    if (lazyFontCN.Owns(font))
+    {
+        for (int i = 0; i < count; i++)
+            lazyFontCN.EnsureGlyph(glyphs[i].codepoint);
+    }
+    activeRenderer->DrawGlyphBatch(font, glyphs, count);
+}
+
+RenderTexture2D GfxLoadLayer(int width, int height)
+{
+    return activeRenderer->LoadLayer(width, height);
+}
+
+void GfxUnloadLayer(RenderTexture2D layer)
+{
+    activeRenderer->UnloadLayer(layer);
+}
+
+void GfxBeginLayer(RenderTexture2D layer)
+{
+    activeRenderer->BeginLayer(layer);
+}
+
+void GfxEndLayer()
+{
+    activeRenderer->EndLayer();
+}
+
+// --- RAYLIB BACKEND ---
+
+// Codepoints in a UTF-8 string: every byte that doesn't continue a sequence
+static int CountCodepoints(const char *text)
+{
+    int count = 0;
+    for (const unsigned char *p = (const unsigned char *)text; *p != 0; p++)
+    {
+        if ((*p & 0xC0) != 0x80)
+            count++;
+    }
+    return count;
+}
+
+void RaylibRenderer::BeginFrame()
+{
+    drawCalls = 0;
+    glyphs = 0;
+}
+
+void RaylibRenderer::ClearBackground(Color color)
+{
+    drawCalls++;
+    ::ClearBackground(color);
+}
+
+void RaylibRenderer::DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    drawCalls++;
+    glyphs += CountCodepoints(text);
+    ::DrawTextEx(font, text, position, fontSize, spacing, tint);
+}
+
+void RaylibRenderer::DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
+{
+    drawCalls++;
+    glyphs++;
+    ::DrawTextCodepoint(font, codepoint, position, fontSize, tint);
+}
+
+void RaylibRenderer::DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    drawCalls++;
+    glyphs += codepointCount;
+    ::DrawTextCodepoints(font, codepoints, codepointCount, position, fontSize, spacing, tint);
+}
+
+void RaylibRenderer::DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    drawCalls++;
+    ::DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+void RaylibRenderer::DrawRectangleRec(Rectangle rec, Color color)
+{
+    drawCalls++;
+    ::DrawRectangleRec(rec, color);
+}
+
+void RaylibRenderer::DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color)
+{
+    drawCalls++;
+    ::DrawRectangleLinesEx(rec, lineThick, color);
+}
+
+void RaylibRenderer::DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
+{
+    drawCalls++;
+    ::DrawRectangleRounded(rec, roundness, segments, color);
+}
+
+void RaylibRenderer::DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color)
+{
+    drawCalls++;
+    ::DrawRectangleRoundedLinesEx(rec, roundness, segments, lineThick, color);
+}
+
+void RaylibRenderer::DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    drawCalls++;
+    ::DrawTriangle(v1, v2, v3, color);
+}
+
+void RaylibRenderer::DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
+{
+    drawCalls++;
+    ::DrawLineEx(startPos, endPos, thick, color);
+}
+
+// The quads DrawTextCodepoint() would draw, all inside one rlBegin() on one
+// texture so rlgl sends them as a single draw call
+void RaylibRenderer::DrawGlyphBatch(Font font, const GlyphInstance *glyphs, int count)
+{
+    const float texWidth = (float)font.texture.width;
+    const float texHeight = (float)font.texture.height;
+    const float padding = (float)font.glyphPadding;
+    drawCalls++;
+    this->glyphs += count;
+
+    // Room for every quad, so the batch isn't flushed halfway
+    rlCheckRenderBatchLimit(4 * count);
+    rlSetTexture(font.texture.id);
+    rlBegin(RL_QUADS);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+
+    for (int i = 0; i < count; i++)
+    {
+        const GlyphInstance &g = glyphs[i];
+        int index = GetGlyphIndex(font, g.codepoint);
+        float scale = g.fontSize / font.baseSize;
+        Rectangle rec = font.recs[index];
+
+        Rectangle src = {rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding};
+        Rectangle dst = {g.position.x + font.glyphs[index].offsetX * scale - padding * scale,
+                         g.position.y + font.glyphs[index].offsetY * scale - padding * scale,
+                         src.width * scale, src.height * scale};
+
+        float u0 = src.x / texWidth, v0 = src.y / texHeight;
+        float u1 = (src.x + src.width) / texWidth, v1 = (src.y + src.height) / texHeight;
+
+        rlColor4ub(g.tint.r, g.tint.g, g.tint.b, g.tint.a);
+        rlTexCoord2f(u0, v0);
+        rlVertex2f(dst.x, dst.y);
+        rlTexCoord2f(u0, v1);
+        rlVertex2f(dst.x, dst.y + dst.height);
+        rlTexCoord2f(u1, v1);
+        rlVertex2f(dst.x + dst.width, dst.y + dst.height);
+        rlTexCoord2f(u1, v0);
+        rlVertex2f(dst.x + dst.width, dst.y);
+    }
+
+    rlEnd();
+    rlSetTexture(0);
+}
+
+// Colour plus the depth buffer raylib attaches, 4 bytes a pixel each
+static long long LayerBytes(int width, int height)
+{
+    return 8LL * width * height;
+}
+
+RenderTexture2D RaylibRenderer::LoadLayer(int width, int height)
+{
+    RenderTexture2D layer = LoadRenderTexture(width, height);
+    if (layer.id != 0)
+        layerBytes += LayerBytes(width, height);
+    return layer;
+}
+
+void RaylibRenderer::UnloadLayer(RenderTexture2D layer)
+{
+    if (layer.id != 0)
+        layerBytes -= LayerBytes(layer.texture.width, layer.texture.height);
+    UnloadRenderTexture(layer);
+}
+
+void RaylibRenderer::BeginLayer(RenderTexture2D layer)
+{
+    BeginTextureMode(layer);
+}
+
+void RaylibRenderer::EndLayer()
+{
+    EndTextureMode();
+    if (frameTarget.id != 0)
+        BeginTextureMode(frameTarget);
+}
+
+// --- RECORDING BACKEND ---
+
+void RecordingRenderer::BeginFrame()
+{
+    frameCmds.clear();
+    stats[currentState].frames++;
+    if (forward)
+        forward->BeginFrame();
+}
+
+void RecordingRenderer::EndFrame()
+{
+    for (const DrawCmd &cmd : frameCmds)
+    {
+        RenderStats &cs = stats[cmd.state];
+        cs.drawCalls++;
+        cs.glyphs += cmd.glyphs;
+        cs.coveredPixels += (double)cmd.w * cmd.h;
+        if (cmd.type == CMD_GLYPH_BATCH && cmd.glyphs > 0)
+            cs.batchedDraws += cmd.glyphs - 1;
+    }
+
+    if (streamFile)
+    {
+        unsigned int count = (unsigned int)frameCmds.size();
+        fwrite(&frameIndex, sizeof(frameIndex), 1, streamFile);
+        fwrite(&count, sizeof(count), 1, streamFile);
+        if (count > 0)
+            fwrite(frameCmds.data(), sizeof(DrawCmd), count, streamFile);
+    }
+    frameIndex++;
+
+    if (forward)
+        forward->EndFrame();
+}
+
+void RecordingRenderer::Record(DrawCmdType type, Rectangle bounds, Color color, int glyphs)
+{
+    DrawCmd cmd;
+    cmd.type = (unsigned char)type;
+    cmd.state = (unsigned char)currentState;
+    cmd.glyphs = (unsigned short)(glyphs > 0xFFFF ? 0xFFFF : glyphs);
+    cmd.color = color;
+    cmd.x = bounds.x;
+    cmd.y = bounds.y;
+    cmd.w = fabsf(bounds.width);
+    cmd.h = fabsf(bounds.height);
+    frameCmds.push_back(cmd);
+}
+
+void RecordingRenderer::ClearBackground(Color color)
+{
+    Record(CMD_CLEAR, {0, 0, (float)GAME_WIDTH, (float)GAME_HEIGHT}, color);
+    if (forward)
+        forward->ClearBackground(color);
+}
+
+// Visible glyphs and bounds of a run of text, either a UTF-8 string or a
+// codepoint array. Widths come from the glyph cache; with no font data
+// (headless runs) glyphs are assumed to be half as wide as they are tall.
+static void MeasureTextRun(Font font, const char *text, const int *codepoints, int codepointCount,
+                           float fontSize, float spacing, int *glyphs, Vector2 *size)
+{
+    *glyphs = 0;
+    int lines = 1;
+    float lineWidth = 0.0f, maxLineWidth = 0.0f;
+
+    int i = 0;
+    while ((text != nullptr) ? text[i] != '\0' : i < codepointCount)
+    {
+        int codepoint;
+        if (text != nullptr)
+        {
+            int bytesProcessed = 0;
+            codepoint = GetCodepointNext(&text[i], &bytesProcessed);
+            i += bytesProcessed;
+        }
+        else
+        {
+            codepoint = codepoints[i++];
+        }
+
+        if (codepoint == '\n')
+        {
+            lines++;
+            lineWidth = 0.0f;
+            continue;
+        }
+
+        // raylib skips spaces and tabs, so they don't count as glyphs
+        if (codepoint != ' ' && codepoint != '\t')
+            (*glyphs)++;
+
+        float advance = GetGlyphAdvance(font, fontSize, codepoint);
+        if (advance <= 0.0f)
+            advance = fontSize * 0.5f;
+        lineWidth += advance + spacing;
+        if (maxLineWidth < lineWidth)
+            maxLineWidth = lineWidth;
+    }
+
+    *size = {maxLineWidth, fontSize * lines};
+}
+
+void RecordingRenderer::DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    int glyphs = 0;
+    Vector2 size;
+    MeasureTextRun(font, text, nullptr, 0, fontSize, spacing, &glyphs, &size);
+
+    Record(CMD_TEXT, {position.x, position.y, size.x, size.y}, tint, glyphs);
+    if (forward)
+        forward->DrawTextEx(font, text, position, fontSize, spacing, tint);
+}
+
+void RecordingRenderer::DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint)
+{
+    int glyphs = 0;
+    Vector2 size;
+    MeasureTextRun(font, nullptr, codepoints, codepointCount, fontSize, spacing, &glyphs, &size);
+
+    Record(CMD_TEXT, {position.x, position.y, size.x, size.y}, tint, glyphs);
+    if (forward)
+        forward->DrawTextCodepoints(font, codepoints, codepointCount, position, fontSize, spacing, tint);
+}
+
+void RecordingRenderer::DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint)
+{
+    float advance = GetGlyphAdvance(font, fontSize, codepoint);
+    if (advance <= 0.0f)
+        advance = fontSize * 0.5f;
+
+    Record(CMD_GLYPH, {position.x, position.y, advance, fontSize}, tint, 1);
+    if (forward)
+        forward->DrawTextCodepoint(font, codepoint, position, fontSize, tint);
+}
+
+void RecordingRenderer::DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint)
+{
+    Record(CMD_TEXTURE, {dest.x - origin.x, dest.y - origin.y, dest.width, dest.height}, tint);
+    if (forward)
+        forward->DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+void RecordingRenderer::DrawRectangleRec(Rectangle rec, Color color)
+{
+    Record(CMD_RECT, rec, color);
+    if (forward)
+        forward->DrawRectangleRec(rec, color);
+}
+
+void RecordingRenderer::DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color)
+{
+    // Only the border is filled
+    float inner = (rec.width - 2 * lineThick) * (rec.height - 2 * lineThick);
+    float border = rec.width * rec.height - (inner > 0 ? inner : 0);
+    Record(CMD_RECT_LINES, {rec.x, rec.y, border / (rec.height > 0 ? rec.height : 1), rec.height}, color);
+    if (forward)
+        forward->DrawRectangleLinesEx(rec, lineThick, color);
+}
+
+void RecordingRenderer::DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color)
+{
+    Record(CMD_RECT_ROUNDED, rec, color);
+    if (forward)
+        forward->DrawRectangleRounded(rec, roundness, segments, color);
+}
+
+void RecordingRenderer::DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color)
+{
+    float inner = (rec.width - 2 * lineThick) * (rec.height - 2 * lineThick);
+    float border = rec.width * rec.height - (inner > 0 ? inner : 0);
+    Record(CMD_RECT_ROUNDED_LINES, {rec.x, rec.y, border / (rec.height > 0 ? rec.height : 1), rec.height}, color);
+    if (forward)
+        forward->DrawRectangleRoundedLinesEx(rec, roundness, segments, lineThick, color);
+}
+
+void RecordingRenderer::DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color)
+{
+    float minX = fminf(v1.x, fminf(v2.x, v3.x));
+    float minY = fminf(v1.y, fminf(v2.y, v3.y));
+    // Store the triangle's true area as a box of the same height
+    float area = fabsf((v2.x - v1.x) * (v3.y - v1.y) - (v3.x - v1.x) * (v2.y - v1.y)) / 2.0f;
+    float h = fmaxf(v1.y, fmaxf(v2.y, v3.y)) - minY;
+    Record(CMD_TRIANGLE, {minX, minY, (h > 0) ? area / h : 0, h}, color);
+    if (forward)
+        forward->DrawTriangle(v1, v2, v3, color);
+}
+
+void RecordingRenderer::DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color)
+{
+    float len = sqrtf((endPos.x - startPos.x) * (endPos.x - startPos.x) + (endPos.y - startPos.y) * (endPos.y - startPos.y));
+    Record(CMD_LINE, {fminf(startPos.x, endPos.x), fminf(startPos.y, endPos.y), len, thick}, color);
+    if (forward)
+        forward->DrawLineEx(startPos, endPos, thick, color);
+}
+
+// One command for the whole batch, covering every glyph's box
+void RecordingRenderer::DrawGlyphBatch(Font font, const GlyphInstance *glyphs, int count)
+{
+    float minX = glyphs[0].position.x, minY = glyphs[0].position.y;
+    float maxX = minX, maxY = minY;
+    for (int i = 0; i < count; i++)
+    {
+        const GlyphInstance &g = glyphs[i];
+        float advance = GetGlyphAdvance(font, g.fontSize, g.codepoint);
+        if (advance <= 0.0f)
+            advance = g.fontSize * 0.5f;
+        minX = fminf(minX, g.position.x);
+        minY = fminf(minY, g.position.y);
+        maxX = fmaxf(maxX, g.position.x + advance);
+        maxY = fmaxf(maxY, g.position.y + g.fontSize);
+    }
+
+    Record(CMD_GLYPH_BATCH, {minX, minY, maxX - minX, maxY - minY}, glyphs[0].tint, count);
+    if (forward)
+        forward->DrawGlyphBatch(font, glyphs, count);
+}
+
+// Layer contents are recorded like any other draw, in the frame they are drawn
+
+RenderTexture2D RecordingRenderer::LoadLayer(int width, int height)
+{
+    if (forward)
+        return forward->LoadLayer(width, height);
+
+    RenderTexture2D layer = {};
+    layer.texture.width = width;
+    layer.texture.height = height;
+    return layer;
+}
+
+void RecordingRenderer::UnloadLayer(RenderTexture2D layer)
+{
+    if (forward)
+        forward->UnloadLayer(layer);
+}
+
+void RecordingRenderer::BeginLayer(RenderTexture2D layer)
+{
+    if (forward)
+        forward->BeginLayer(layer);
+}
+
+void RecordingRenderer::EndLayer()
+{
+    if (forward)
+        forward->EndLayer();
+}
+
+void RecordingRenderer::PrintStats()
+{
+    static const char *stateNames[GAME_STATE_COUNT] = {"MENU", "MAP_WALK", "DIALOGUE", "BATTLE", "GAME_OVER"};
+    const double screenPixels = (double)GAME_WIDTH * GAME_HEIGHT;
+
+    printf("%-10s %8s %12s %12s %10s %14s\n", "State", "Frames", "Draws/frame", "Glyphs/frame", "Overdraw", "Batched/frame");
+    for (int i = 0; i < GAME_STATE_COUNT; i++)
+    {
+        const RenderStats &s = stats[i];
+        if (s.frames == 0)
+            continue;
+        printf("%-10s %8ld %12.1f %12.1f %9.2fx %14.1f\n", stateNames[i], s.frames,
+               (double)s.drawCalls / s.frames,
+               (double)s.glyphs / s.frames,
+               s.coveredPixels / s.frames / screenPixels,
+               (double)s.batchedDraws / s.frames);
+    }
+}
+
+// --- SETUP ---
+
+void InitRenderer(bool headless, const char *recordPath)
+{
+    if (!headless && recordPath == nullptr)
+    {
+        activeRenderer = &raylibRenderer;
+        return;
+    }
+
+    recordingRenderer.forward = headless ? nullptr : &raylibRenderer;
+    if (recordPath != nullptr)
+    {
+        recordingRenderer.streamFile = fopen(recordPath, "wb");
+        if (recordingRenderer.streamFile == nullptr)
+            TraceLog(LOG_WARNING, "Could not open draw stream file %s", recordPath);
+    }
+    activeRenderer = &recordingRenderer;
+}
+
+void ShutdownRenderer()
+{
+    if (activeRenderer == &recordingRenderer)
+        recordingRenderer.PrintStats();
+
+    if (recordingRenderer.streamFile != nullptr)
+    {
+        fclose(recordingRenderer.streamFile);
+        recordingRenderer.streamFile = nullptr;
+    }
+}
+
+void BeginRenderFrame()
+{
+    lazyFontCN.NewFrame();
+    activeRenderer->BeginFrame();
+}
+
+void EndRenderFrame()
+{
+    activeRenderer->EndFrame();
+}
+
+// --- REDRAW ---
+
+// Stands in for the real renderer on skipped ticks: drops frame draws but
+// passes layer work through, since a layer only draws what is new
+class SkipRenderer : public Renderer
+{
+public:
+    Renderer *inner = nullptr;
+    int layerDepth = 0;
+
+    void ClearBackground(Color color) override
+    {
+        if (layerDepth > 0)
+            inner->ClearBackground(color);
+    }
+    void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) override
+    {
+        if (layerDepth > 0)
+            inner->DrawTextEx(font, text, position, fontSize, spacing, tint);
+    }
+    void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) override
+    {
+        if (layerDepth > 0)
+            inner->DrawTextCodepoint(font, codepoint, position, fontSize, tint);
+    }
+    void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint) override
+    {
+        if (layerDepth > 0)
+            inner->DrawTextCodepoints(font, codepoints, codepointCount, position, fontSize, spacing, tint);
+    }
+    void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override
+    {
+        if (layerDepth > 0)
+            inner->DrawTexturePro(texture, source, dest, origin, rotation, tint);
+    }
+    void DrawRectangleRec(Rectangle rec, Color color) override
+    {
+        if (layerDepth > 0)
+            inner->DrawRectangleRec(rec, color);
+    }
+    void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color) override
+    {
+        if (layerDepth > 0)
+            inner->DrawRectangleLinesEx(rec, lineThick, color);
+    }
+    void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override
+    {
+        if (layerDepth > 0)
+            inner->DrawRectangleRounded(rec, roundness, segments, color);
+    }
+    void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color) override
+    {
+        if (layerDepth > 0)
+            inner->DrawRectangleRoundedLinesEx(rec, roundness, segments, lineThick, color);
+    }
+    void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) override
+    {
+        if (layerDepth > 0)
+            inner->DrawTriangle(v1, v2, v3, color);
+    }
+    void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color) override
+    {
+        if (layerDepth > 0)
+            inner->DrawLineEx(startPos, endPos, thick, color);
+    }
+    void DrawGlyphBatch(Font font, const GlyphInstance *glyphs, int count) override
+    {
+        if (layerDepth > 0)
+            inner->DrawGlyphBatch(font, glyphs, count);
+    }
+
+    RenderTexture2D LoadLayer(int width, int height) override { return inner->LoadLayer(width, height); }
+    void UnloadLayer(RenderTexture2D layer) override { inner->UnloadLayer(layer); }
+    void BeginLayer(RenderTexture2D layer) override
+    {
+        layerDepth++;
+        inner->BeginLayer(layer);
+    }
+    void EndLayer() override
+    {
+        inner->EndLayer();
+        layerDepth--;
+    }
+};
+
+static SkipRenderer skipRenderer;
+static bool frameDirty = true; // The first frame always draws
+
+void MarkFrameDirty()
+{
+    frameDirty = true;
+}
+
+bool TakeFrameDirty()
+{
+    bool dirty = frameDirty;
+    frameDirty = false;
+    return dirty;
+}
+
+void SetFrameDrawsSkipped(bool skipped)
+{
+    if (skipped && activeRenderer != &skipRenderer)
+    {
+        skipRenderer.inner = activeRenderer;
+        activeRenderer = &skipRenderer;
+    }
+    else if (!skipped && activeRenderer == &skipRenderer)
+    {
+        activeRenderer = skipRenderer.inner;
+    }
+}
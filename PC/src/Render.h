@@ -0,0 +1,214 @@
+#ifndef RENDER_H
+#define RENDER_H
+
+#include "game_defs.h"
+#include <cstdio>
+
+// --- DRAW WRAPPERS ---
+// Every draw call in the game goes through these instead of raylib directly.
+// They forward to the active Renderer, which is either raylib itself or the
+// recorder (headless runs, or --record).
+void GfxClearBackground(Color color);
+void GfxDrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint);
+void GfxDrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint);
+void GfxDrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint);
+void GfxDrawTexture(Texture2D texture, int posX, int posY, Color tint);
+void GfxDrawTextureEx(Texture2D texture, Vector2 position, float rotation, float scale, Color tint);
+void GfxDrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint);
+void GfxDrawRectangle(int posX, int posY, int width, int height, Color color);
+void GfxDrawRectangleRec(Rectangle rec, Color color);
+void GfxDrawRectangleLinesEx(Rectangle rec, float lineThick, Color color);
+void GfxDrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color);
+void GfxDrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color);
+void GfxDrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color);
+void GfxDrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color);
+
+// --- GLYPH BATCHES ---
+// One DrawTextCodepoint() worth of glyph. A batch is any number of them from
+// one font, sent to the GPU as a single draw instead of one per glyph.
+struct GlyphInstance
+{
+    int codepoint;
+    Vector2 position;
+    float fontSize;
+    Color tint;
+};
+
+void GfxDrawGlyphBatch(Font font, const GlyphInstance *glyphs, int count);
+
+// --- LAYERS ---
+// Offscreen textures that keep what was drawn into them between frames.
+// Draws between GfxBeginLayer() and GfxEndLayer() land in the layer; draw
+// layer.texture afterwards with a negative source height (OpenGL stores it
+// upside down). Without a GPU (headless runs) the texture is a placeholder.
+RenderTexture2D GfxLoadLayer(int width, int height);
+void GfxUnloadLayer(RenderTexture2D layer);
+void GfxBeginLayer(RenderTexture2D layer);
+void GfxEndLayer();
+
+// --- RENDERER INTERFACE ---
+class Renderer
+{
+public:
+    virtual ~Renderer() {}
+
+    virtual void BeginFrame() {}
+    virtual void EndFrame() {}
+
+    virtual void ClearBackground(Color color) = 0;
+    virtual void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) = 0;
+    virtual void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) = 0;
+    virtual void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint) = 0;
+    virtual void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) = 0;
+    virtual void DrawRectangleRec(Rectangle rec, Color color) = 0;
+    virtual void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color) = 0;
+    virtual void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) = 0;
+    virtual void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color) = 0;
+    virtual void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) = 0;
+    virtual void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color) = 0;
+    virtual void DrawGlyphBatch(Font font, const GlyphInstance *glyphs, int count) = 0;
+
+    virtual RenderTexture2D LoadLayer(int width, int height) = 0;
+    virtual void UnloadLayer(RenderTexture2D layer) = 0;
+    virtual void BeginLayer(RenderTexture2D layer) = 0;
+    virtual void EndLayer() = 0;
+};
+
+// Straight to raylib/OpenGL
+class RaylibRenderer : public Renderer
+{
+public:
+    // The texture the game frame is drawn into, bound again after a layer
+    // (raylib's texture modes don't nest)
+    RenderTexture2D frameTarget = {};
+
+    // For the perf HUD: draws and glyphs sent since BeginFrame() (skipped
+    // ticks don't begin a frame, so these hold the last one drawn), and the
+    // memory held by layers loaded through here
+    int drawCalls = 0;
+    int glyphs = 0;
+    long long layerBytes = 0;
+
+    void BeginFrame() override;
+
+    void ClearBackground(Color color) override;
+    void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) override;
+    void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) override;
+    void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint) override;
+    void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+    void DrawRectangleRec(Rectangle rec, Color color) override;
+    void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color) override;
+    void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override;
+    void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color) override;
+    void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) override;
+    void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color) override;
+    void DrawGlyphBatch(Font font, const GlyphInstance *glyphs, int count) override;
+
+    RenderTexture2D LoadLayer(int width, int height) override;
+    void UnloadLayer(RenderTexture2D layer) override;
+    void BeginLayer(RenderTexture2D layer) override;
+    void EndLayer() override;
+};
+
+// --- COMMAND RECORDING ---
+enum DrawCmdType
+{
+    CMD_CLEAR,
+    CMD_TEXT,
+    CMD_TEXTURE,
+    CMD_RECT,
+    CMD_RECT_LINES,
+    CMD_RECT_ROUNDED,
+    CMD_RECT_ROUNDED_LINES,
+    CMD_TRIANGLE,
+    CMD_LINE,
+    CMD_GLYPH,
+    CMD_GLYPH_BATCH
+};
+
+// One recorded draw call (24 bytes). Bounds are the screen area it covers.
+struct DrawCmd
+{
+    unsigned char type;   // DrawCmdType
+    unsigned char state;  // GameState when it was issued
+    unsigned short glyphs; // Visible glyphs (text only)
+    Color color;
+    float x, y, w, h;
+};
+
+const int GAME_STATE_COUNT = GAME_OVER + 1;
+
+// Totals per GameState across the whole run
+struct RenderStats
+{
+    long frames;
+    long drawCalls;
+    long glyphs;
+    double coveredPixels; // Sum of every draw's area, so overdraw = covered / screen
+    long batchedDraws;    // Draws that glyph batches replaced (glyphs - batches)
+};
+
+// Null renderer: never touches OpenGL. Keeps this frame's commands, folds
+// them into per-state stats, and optionally appends them to a stream file
+// (per frame: uint32 frame index, uint32 count, then count DrawCmds) so two
+// builds can be diffed. Pass a renderer to forward to if the game should
+// still appear on screen while recording.
+class RecordingRenderer : public Renderer
+{
+public:
+    std::vector<DrawCmd> frameCmds;
+    RenderStats stats[GAME_STATE_COUNT] = {};
+    Renderer *forward = nullptr;
+    FILE *streamFile = nullptr;
+    unsigned int frameIndex = 0;
+
+    void BeginFrame() override;
+    void EndFrame() override;
+
+    void ClearBackground(Color color) override;
+    void DrawTextEx(Font font, const char *text, Vector2 position, float fontSize, float spacing, Color tint) override;
+    void DrawTextCodepoint(Font font, int codepoint, Vector2 position, float fontSize, Color tint) override;
+    void DrawTextCodepoints(Font font, const int *codepoints, int codepointCount, Vector2 position, float fontSize, float spacing, Color tint) override;
+    void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) override;
+    void DrawRectangleRec(Rectangle rec, Color color) override;
+    void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color) override;
+    void DrawRectangleRounded(Rectangle rec, float roundness, int segments, Color color) override;
+    void DrawRectangleRoundedLinesEx(Rectangle rec, float roundness, int segments, float lineThick, Color color) override;
+    void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) override;
+    void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color) override;
+    void DrawGlyphBatch(Font font, const GlyphInstance *glyphs, int count) override;
+
+    RenderTexture2D LoadLayer(int width, int height) override;
+    void UnloadLayer(RenderTexture2D layer) override;
+    void BeginLayer(RenderTexture2D layer) override;
+    void EndLayer() override;
+
+    void PrintStats();
+
+private:
+    void Record(DrawCmdType type, Rectangle bounds, Color color, int glyphs = 0);
+};
+
+extern Renderer *activeRenderer;
+extern RaylibRenderer raylibRenderer;
+extern RecordingRenderer recordingRenderer;
+
+// Picks the backend: the recorder when headless or when recordPath is set
+// (forwarding to raylib if there is a window), raylib otherwise.
+void InitRenderer(bool headless, const char *recordPath);
+void ShutdownRenderer();
+
+void BeginRenderFrame();
+void EndRenderFrame();
+
+// --- REDRAW ---
+// The window only draws a tick when something on screen may have changed
+// since the last one it drew. Input, state changes, the typewriter and the
+// player moving mark the frame dirty; anything that animates on its own
+// calls MarkFrameDirty() every tick it runs. A skipped tick still runs its
+// handlers, but their draws are dropped (layers are still drawn into).
+void MarkFrameDirty();
+bool TakeFrameDirty(); // Returns the flag and clears it
+void SetFrameDrawsSkipped(bool skipped);
+
+#endif
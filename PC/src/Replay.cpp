@@ -0,0 +1,104 @@
+#include "Replay.h"
+#include "Globals.h"
+#include "Input.h"
+#include "Sim.h"
+#include <cstdio>
+#include <vector>
+
+static std::vector<uint32_t> replayTicks;
+static bool replaying = false;
+static long replayTick = 0; // Ticks recorded or replayed so far
+
+static FILE *recording = nullptr;
+static InputRecordingHeader recordingHeader;
+
+bool StartInputReplay(const char *path)
+{
+    FILE *in = fopen(path, "rb");
+    if (in == nullptr)
+    {
+        TraceLog(LOG_ERROR, "REPLAY: cannot open %s", path);
+        return false;
+    }
+
+    InputRecordingHeader header;
+    bool ok = fread(&header, sizeof(header), 1, in) == 1 &&
+              header.magic == INPUT_RECORDING_MAGIC && header.version == INPUT_RECORDING_VERSION &&
+              header.fixedDt > 0.0f;
+
+    uint32_t keys;
+    while (ok && fread(&keys, sizeof(keys), 1, in) == 1)
+        replayTicks.push_back(keys);
+    fclose(in);
+
+    if (!ok)
+    {
+        TraceLog(LOG_ERROR, "REPLAY: %s is not an input recording", path);
+        replayTicks.clear();
+        return false;
+    }
+    if (header.tickCount != 0 && header.tickCount < replayTicks.size())
+        replayTicks.resize(header.tickCount);
+
+    simConfig.seed = header.seed;
+    simConfig.fixedDt = header.fixedDt;
+    SetLanguage((header.language == LANG_CN) ? LANG_CN : LANG_EN);
+    replaying = true;
+
+    TraceLog(LOG_INFO, "REPLAY: %d ticks from %s", (int)replayTicks.size(), path);
+    return true;
+}
+
+bool StartInputRecording(const char *path)
+{
+    recording = fopen(path, "wb");
+    if (recording == nullptr)
+    {
+        TraceLog(LOG_ERROR, "REPLAY: cannot write %s", path);
+        return false;
+    }
+
+    recordingHeader = {};
+    recordingHeader.magic = INPUT_RECORDING_MAGIC;
+    recordingHeader.version = INPUT_RECORDING_VERSION;
+    recordingHeader.seed = simConfig.seed;
+    recordingHeader.fixedDt = simConfig.fixedDt;
+    recordingHeader.language = (uint32_t)currentLanguage;
+    fwrite(&recordingHeader, sizeof(recordingHeader), 1, recording);
+    return true;
+}
+
+void UpdateInputReplay()
+{
+    if (replaying && replayTick < (long)replayTicks.size())
+        InjectInputTick(replayTicks[replayTick]);
+
+    if (recording != nullptr)
+    {
+        uint32_t keys = CaptureInputTick();
+        fwrite(&keys, sizeof(keys), 1, recording);
+        recordingHeader.tickCount++;
+    }
+    replayTick++;
+}
+
+bool IsReplaying()
+{
+    return replaying;
+}
+
+bool IsReplayFinished()
+{
+    return replaying && replayTick >= (long)replayTicks.size();
+}
+
+void StopInputRecording()
+{
+    if (recording == nullptr)
+        return;
+
+    fseek(recording, 0, SEEK_SET);
+    fwrite(&recordingHeader, sizeof(recordingHeader), 1, recording);
+    fclose(recording);
+    recording = nullptr;
+}
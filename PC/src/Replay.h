@@ -0,0 +1,47 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdint.h>
+
+// --- INPUT RECORDING / REPLAY ---
+// A recording is every key state gameplay saw, tick by tick, plus what else
+// decides how a run plays out: the GetRandomValue seed, the tick length and
+// the starting language. Playing it back (windowed, or headless at full
+// speed) repeats the run exactly, so real playthroughs can be re-run as
+// performance workloads and a spike pinned to its tick.
+//
+// Layout, little endian:
+//   InputRecordingHeader
+//   tickCount x uint32_t    CaptureInputTick() of tick 0, 1, ...
+
+#define INPUT_RECORDING_MAGIC 0x52495455 // "UTIR"
+#define INPUT_RECORDING_VERSION 1
+
+struct InputRecordingHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t seed;
+    float fixedDt;
+    uint32_t language;
+    uint32_t tickCount; // 0 if the game didn't exit cleanly; use the file size
+};
+
+// Loads a recording and applies its seed, tick length and language to the
+// sim config. Call before InitGame().
+bool StartInputReplay(const char *path);
+bool StartInputRecording(const char *path);
+
+// Call once per tick, after the tick's input is set and before the state
+// handlers run: replays the recorded keys or records the live ones. Tick 0
+// is the first tick after the asset loader finished (the menu ignores keys
+// while loading, and how long that takes differs between runs).
+void UpdateInputReplay();
+
+bool IsReplaying();
+bool IsReplayFinished();
+
+// Writes the tick count and closes the recording
+void StopInputRecording();
+
+#endif
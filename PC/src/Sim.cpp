@@ -0,0 +1,142 @@
+#include "Sim.h"
+#include "Globals.h"
+#include "Input.h"
+#include "Player.h"
+#include "Battle.h"
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+SimConfig simConfig;
+long simTick = 0;
+float renderAlpha = 1.0f;
+
+// Defined in main.cpp
+extern NPC mapEnemy;
+
+// Autopilot progress
+static bool sawPostBattleDialogue = false;
+static bool playthroughComplete = false;
+
+void ParseSimArgs(int argc, char **argv)
+{
+    bool seedGiven = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--headless") == 0)
+            simConfig.headless = true;
+        else if (strcmp(argv[i], "--dt") == 0 && i + 1 < argc)
+            simConfig.fixedDt = (float)atof(argv[++i]);
+        else if (strcmp(argv[i], "--hz") == 0 && i + 1 < argc)
+        {
+            float hz = (float)atof(argv[++i]);
+            simConfig.fixedDt = (hz > 0.0f) ? 1.0f / hz : 0.0f;
+        }
+        else if (strcmp(argv[i], "--ticks") == 0 && i + 1 < argc)
+            simConfig.maxTicks = atol(argv[++i]);
+        else if (strcmp(argv[i], "--lang") == 0 && i + 1 < argc)
+            SetLanguage((strcmp(argv[++i], "cn") == 0) ? LANG_CN : LANG_EN);
+        else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+            simConfig.recordPath = argv[++i];
+        else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+        {
+            simConfig.seed = (unsigned int)strtoul(argv[++i], nullptr, 10);
+            seedGiven = true;
+        }
+        else if (strcmp(argv[i], "--record-input") == 0 && i + 1 < argc)
+            simConfig.inputRecordPath = argv[++i];
+        else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+            simConfig.replayPath = argv[++i];
+        else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+            simConfig.tracePath = argv[++i];
+    }
+
+    if (simConfig.fixedDt <= 0.0f)
+        simConfig.fixedDt = 1.0f / 60.0f;
+    if (!simConfig.headless && !seedGiven)
+        simConfig.seed = (unsigned int)time(nullptr);
+}
+
+float GetGameFrameTime()
+{
+    return simConfig.fixedDt;
+}
+
+// Taps a key every other tick so each tap registers as a fresh press
+static void TapKey(int key)
+{
+    SetVirtualKey(key, (simTick % 2) == 0);
+}
+
+// Direction from the current box towards the side that stays when it
+// shrinks, held until the heart hits the wall
+static int SafeDirection()
+{
+    Rect box, safe;
+    if (!GetBattleSafeRect(&box, &safe))
+        return KEY_NULL;
+
+    // Centres doubled to stay in integers
+    int dx = (2 * safe.x + safe.w) - (2 * box.x + box.w);
+    int dy = (2 * safe.y + safe.h) - (2 * box.y + box.h);
+    if (dx == 0 && dy == 0)
+        return KEY_NULL;
+    if (abs(dx) >= abs(dy))
+        return (dx > 0) ? KEY_RIGHT : KEY_LEFT;
+    return (dy > 0) ? KEY_DOWN : KEY_UP;
+}
+
+void UpdateAutoPilot()
+{
+    BeginInputTick();
+
+    SetVirtualKey(KEY_Z, false);
+    SetVirtualKey(KEY_LEFT, false);
+    SetVirtualKey(KEY_RIGHT, false);
+    SetVirtualKey(KEY_UP, false);
+    SetVirtualKey(KEY_DOWN, false);
+
+    switch (currentState)
+    {
+    case MENU:
+    case DIALOGUE:
+    case GAME_OVER:
+        // Menus default to the story path (YES, GIVE, Coffee), so Z is enough
+        TapKey(KEY_Z);
+        if (currentState == DIALOGUE && battleCompleted)
+            sawPostBattleDialogue = true;
+        break;
+
+    case MAP_WALK:
+    {
+        if (sawPostBattleDialogue)
+        {
+            playthroughComplete = true;
+            break;
+        }
+
+        // Walk right until the robot blocks us, then talk to it
+        float dx = player.pos.x - mapEnemy.x;
+        float dy = player.pos.y - mapEnemy.y;
+        if (dx * dx + dy * dy >= 90.0f * 90.0f)
+            SetVirtualKey(KEY_RIGHT, true);
+        else
+            TapKey(KEY_Z);
+    }
+    break;
+
+    case BATTLE:
+    {
+        TapKey(KEY_Z);
+        int dir = SafeDirection();
+        if (dir != KEY_NULL)
+            SetVirtualKey(dir, true);
+    }
+    break;
+    }
+}
+
+bool IsPlaythroughComplete()
+{
+    return playthroughComplete;
+}
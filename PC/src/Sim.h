@@ -0,0 +1,46 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include "game_defs.h"
+
+// --- SIMULATION ---
+// The game always advances in fixed ticks of fixedDt, windowed or not, so a
+// run plays out the same at any refresh rate. The window accumulates real
+// time and runs as many ticks as it pays for (see main()).
+//
+// Headless runs skip the window, audio device and asset loading, and step the
+// state handlers as fast as the CPU allows. Input comes from the autopilot,
+// which plays the game start to finish.
+struct SimConfig
+{
+    bool headless = false;
+    float fixedDt = 1.0f / 60.0f; // Seconds per tick
+    long maxTicks = 0;            // 0 = stop when the playthrough is complete
+    const char *recordPath = nullptr; // Draw command stream output (see Render.h)
+    unsigned int seed = 1;            // GetRandomValue seed; windowed runs take the clock unless --seed
+    const char *inputRecordPath = nullptr; // Input recording output (see Replay.h)
+    const char *replayPath = nullptr;      // Input recording to play back
+    const char *tracePath = nullptr;       // Profiling zones output (see Profiler.h)
+};
+
+extern SimConfig simConfig;
+extern long simTick;
+
+// How far real time is past the last tick, in ticks (0..1). Moving things
+// are drawn this far from their previous tick position towards the current
+// one. Always 1 headless.
+extern float renderAlpha;
+
+// Parses --headless, --dt <seconds>, --hz <ticks per second>, --ticks <n>,
+// --lang <en|cn>, --record <file>, --seed <n>, --record-input <file>,
+// --replay <file> and --trace <file>
+void ParseSimArgs(int argc, char **argv);
+
+// Use this instead of GetFrameTime() in gameplay code: the fixed tick length
+float GetGameFrameTime();
+
+// Headless input driver: sets the virtual keys for the current tick
+void UpdateAutoPilot();
+bool IsPlaythroughComplete();
+
+#endif
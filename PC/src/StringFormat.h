@@ -0,0 +1,54 @@
+#ifndef STRING_FORMAT_H
+#define STRING_FORMAT_H
+
+#include <stdint.h>
+
+// --- COMPILED STRING CATALOG (.bin) ---
+// Written by tools/StringCompiler.cpp from assets/strings.catalog and read in
+// place by both the PC game and the ESP32 sketch (which keeps a copy of this
+// file). Layout, little endian:
+//   StringTableHeader
+//   columnCount x StringColumn
+//   columnCount x stringCount x StringEntry (one block per column, in id order)
+//   textBytes of NUL terminated UTF-8 strings
+// Every table starts 4-byte aligned.
+
+#define STRINGS_MAGIC 0x54535455 // "UTST"
+#define STRINGS_VERSION 1
+
+// Same columns as the dialogue script: English, Chinese, and the short
+// English used on the ESP32's 160x128 screen
+#define STRING_COLUMNS 3
+#define STRING_COL_EN 0
+#define STRING_COL_CN 1
+#define STRING_COL_LCD 2
+
+struct StringTableHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint16_t stringCount;
+    uint16_t columnCount;
+    uint32_t textBytes;
+    uint32_t idHash; // Of the id names, must match STRING_IDS_HASH in StringIds.h
+};
+
+struct StringColumn
+{
+    float baseSize; // Font size the widths were measured at, 0 = not measured
+    uint32_t reserved;
+};
+
+// MeasureTextEx() is linear in the font size, so one width per string covers
+// every size: width * fontSize / baseSize + spacingCount * spacing
+struct StringEntry
+{
+    uint32_t offset;       // Into the text blob
+    float width;           // Widest line's advances at baseSize
+    uint16_t codepoints;   // Whole string, newlines included
+    uint16_t spacingCount; // Times raylib adds the spacing: longest line's codepoints, its '\n' included, - 1
+    uint16_t lines;
+    uint16_t reserved;
+};
+
+#endif
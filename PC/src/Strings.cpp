@@ -0,0 +1,134 @@
+#include "Strings.h"
+#include "StringFormat.h"
+#include "AssetPack.h"
+#include "Fonts.h"
+#include "MappedFile.h"
+#include <cstring>
+
+static MappedFile looseFile; // When strings.bin isn't in the pack
+static const StringColumn *columns = nullptr;
+static const StringEntry *entries = nullptr; // columnCount blocks of stringCount
+static const char *text = nullptr;
+
+// The current language's column and block
+static int activeColumn = STRING_COL_EN;
+static const StringEntry *activeEntries = nullptr;
+
+static int LanguageColumn(Language lang)
+{
+    return (lang == LANG_CN) ? STRING_COL_CN : STRING_COL_EN;
+}
+
+// Tables are used in place, so everything is checked up front
+static bool ParseStringCatalog(const unsigned char *data, size_t size)
+{
+    StringTableHeader header;
+    if (size < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != STRINGS_MAGIC || header.version != STRINGS_VERSION)
+        return false;
+
+    // Built from another catalog than this executable
+    if (header.idHash != STRING_IDS_HASH || header.stringCount != STRING_COUNT ||
+        header.columnCount != STRING_COLUMNS)
+    {
+        TraceLog(LOG_WARNING, "STRINGS: table doesn't match this build's ids, rebuild it");
+        return false;
+    }
+
+    size_t columnBytes = STRING_COLUMNS * sizeof(StringColumn);
+    size_t entryBytes = (size_t)STRING_COLUMNS * STRING_COUNT * sizeof(StringEntry);
+    if (sizeof(header) + columnBytes + entryBytes + header.textBytes > size || header.textBytes == 0)
+        return false;
+
+    const StringEntry *table = (const StringEntry *)(data + sizeof(header) + columnBytes);
+    const char *blob = (const char *)table + entryBytes;
+    if (blob[header.textBytes - 1] != '\0')
+        return false;
+    for (int i = 0; i < STRING_COLUMNS * STRING_COUNT; i++)
+    {
+        if (table[i].offset >= header.textBytes)
+            return false;
+    }
+
+    columns = (const StringColumn *)(data + sizeof(header));
+    entries = table;
+    text = blob;
+    return true;
+}
+
+bool LoadStringCatalog(const char *name)
+{
+    UnloadStringCatalog();
+
+    int size = 0;
+    const unsigned char *data = GetPackedAsset(name, &size);
+    if (data == nullptr)
+    {
+        if (!MapFile(TextFormat("assets/%s", name), &looseFile))
+            return false;
+        data = looseFile.data;
+        size = (int)looseFile.size;
+    }
+
+    if (!ParseStringCatalog(data, (size_t)size))
+    {
+        TraceLog(LOG_WARNING, "%s is not a valid string table", name);
+        UnloadStringCatalog();
+        return false;
+    }
+
+    SelectStringLanguage(currentLanguage);
+    return true;
+}
+
+void UnloadStringCatalog()
+{
+    UnmapFile(&looseFile);
+    columns = nullptr;
+    entries = nullptr;
+    text = nullptr;
+    activeEntries = nullptr;
+}
+
+void SelectStringLanguage(Language lang)
+{
+    activeColumn = LanguageColumn(lang);
+    if (entries != nullptr)
+        activeEntries = entries + (size_t)activeColumn * STRING_COUNT;
+}
+
+const char *Str(StringId id)
+{
+    if (activeEntries == nullptr || id >= STRING_COUNT)
+        return "";
+    return text + activeEntries[id].offset;
+}
+
+int GetStringLength(StringId id)
+{
+    if (activeEntries == nullptr || id >= STRING_COUNT)
+        return 0;
+    return activeEntries[id].codepoints;
+}
+
+float MeasureStringWidth(Font font, StringId id, float fontSize, float spacing)
+{
+    if (activeEntries == nullptr || id >= STRING_COUNT)
+        return 0.0f;
+
+    // The widths are for the font the catalog was built against; a fallback
+    // font (gameFont while loading, or no texture in headless runs) measures
+    // on its own
+    const StringColumn &column = columns[activeColumn];
+    Font languageFont = (activeColumn == STRING_COL_CN) ? fontCN : fontEN;
+    if (column.baseSize <= 0.0f || font.texture.id == 0 || font.texture.id != languageFont.texture.id ||
+        (float)font.baseSize != column.baseSize)
+        return MeasureGameText(font, Str(id), fontSize, spacing).x;
+
+    const StringEntry &entry = activeEntries[id];
+    if (entry.codepoints == 0)
+        return 0.0f;
+    return entry.width * (fontSize / column.baseSize) + (float)entry.spacingCount * spacing;
+}
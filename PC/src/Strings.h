@@ -0,0 +1,34 @@
+#ifndef STRINGS_H
+#define STRINGS_H
+
+#include "Globals.h"
+#include "StringIds.h" // Generated from assets/strings.catalog
+
+// --- STRING CATALOG ---
+// UI and battle text lives in assets/strings.catalog, compiled at build time
+// into strings.bin (see StringFormat.h) and the STR_ ids above. The table is
+// used in place: a slice of the mapped asset pack, or the loose file mapped
+// on its own. Each language is one block of entries, so SetLanguage() only
+// moves a pointer.
+
+bool LoadStringCatalog(const char *name);
+void UnloadStringCatalog();
+
+// Points Str() at lang's block; SetLanguage() calls this
+void SelectStringLanguage(Language lang);
+
+// The current language's text, "" for STR_NONE or without a catalog. The
+// address stays the same until UnloadStringCatalog(), so it can key caches
+// (DrawCenteredText(), GetWrappedText()).
+const char *Str(StringId id);
+
+// Codepoints in Str(id), decoded at build time
+int GetStringLength(StringId id);
+
+// MeasureGameText(font, Str(id), fontSize, spacing).x from the build-time
+// measurement when font is the one the current language is drawn with, so
+// the string isn't walked; measured here otherwise (another font, a catalog
+// built without the font files).
+float MeasureStringWidth(Font font, StringId id, float fontSize, float spacing);
+
+#endif
@@ -2,6 +2,7 @@
 #define TEXT_ALIGNMENT_H
 
 #include "raylib.h"
+#include "Fonts.h"
 
 struct TextMetrics
 {
@@ -13,7 +14,7 @@ struct TextMetrics
 inline TextMetrics GetCenteredTextPosition(Font font, const char *text, float fontSize, float spacing, float screenWidth = 800.0f)
 {
     // Measure the text using the custom font
-    Vector2 size = MeasureTextEx(font, text, fontSize, spacing);
+    Vector2 size = MeasureGameText(font, text, fontSize, spacing);
     float x = (screenWidth - size.x) / 2.0f;
     return {size.x, x};
 }
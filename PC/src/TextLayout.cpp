@@ -0,0 +1,271 @@
+#include "TextLayout.h"
+#include "Globals.h"
+#include "Fonts.h"
+#include "GlyphCache.h"
+#include <string>
+#include <unordered_map>
+
+// raylib's default SetTextLineSpacing(), which DrawTextEx() adds per newline
+#define TEXT_LINE_SPACING 2
+
+struct TextLayoutKey
+{
+    const char *text;
+    unsigned int fontId;
+    float fontSize;
+    float spacing;
+    float maxWidth; // Wrapped text only
+
+    bool operator==(const TextLayoutKey &other) const
+    {
+        return text == other.text && fontId == other.fontId &&
+               fontSize == other.fontSize && spacing == other.spacing && maxWidth == other.maxWidth;
+    }
+};
+
+struct TextLayoutKeyHash
+{
+    size_t operator()(const TextLayoutKey &key) const
+    {
+        size_t h = std::hash<const void *>()(key.text);
+        h = h * 31 + key.fontId;
+        h = h * 31 + (size_t)(key.fontSize * 64.0f);
+        h = h * 31 + (size_t)(key.spacing * 64.0f);
+        h = h * 31 + (size_t)key.maxWidth;
+        return h;
+    }
+};
+
+// Node based, so a returned layout stays put while others are added
+static std::unordered_map<TextLayoutKey, TextLayout, TextLayoutKeyHash> layouts;
+static std::unordered_map<TextLayoutKey, std::string, TextLayoutKeyHash> wrapped;
+static Language layoutLanguage = LANG_EN;
+
+// Str() hands back other strings, and what was built for them goes stale
+static void CheckLanguage()
+{
+    if (currentLanguage != layoutLanguage)
+    {
+        layouts.clear();
+        wrapped.clear();
+        layoutLanguage = currentLanguage;
+    }
+}
+
+// DrawTextEx()'s placement, with advances from the glyph cache
+static void BuildTextLayout(TextLayout &layout, Font font, const char *text, float fontSize, float spacing,
+                            float width, int codepoints)
+{
+    layout.width = width;
+    layout.glyphs.clear();
+    layout.glyphs.reserve(codepoints);
+
+    float x = 0.0f, y = 0.0f;
+    int i = 0;
+    while (text[i] != '\0')
+    {
+        int bytesProcessed = 0;
+        int codepoint = GetCodepointNext(&text[i], &bytesProcessed);
+        i += bytesProcessed;
+
+        if (codepoint == '\n')
+        {
+            x = 0.0f;
+            y += fontSize + TEXT_LINE_SPACING;
+            continue;
+        }
+
+        if (codepoint != ' ' && codepoint != '\t')
+            layout.glyphs.push_back({codepoint, {x, y}, fontSize, WHITE});
+        x += GetGlyphAdvance(font, fontSize, codepoint) + spacing;
+    }
+}
+
+const TextLayout &GetTextLayout(Font font, const char *text, float fontSize, float spacing)
+{
+    CheckLanguage();
+
+    TextLayoutKey key = {text, font.texture.id, fontSize, spacing, 0.0f};
+    auto it = layouts.find(key);
+    if (it != layouts.end())
+        return it->second;
+
+    TextLayout &layout = layouts[key];
+    BuildTextLayout(layout, font, text, fontSize, spacing, MeasureGameText(font, text, fontSize, spacing).x, 0);
+    return layout;
+}
+
+// Keyed by the catalog text's address, so it shares entries with the above
+static const TextLayout &GetStringLayout(Font font, StringId id, float fontSize, float spacing)
+{
+    CheckLanguage();
+
+    const char *text = Str(id);
+    TextLayoutKey key = {text, font.texture.id, fontSize, spacing, 0.0f};
+    auto it = layouts.find(key);
+    if (it != layouts.end())
+        return it->second;
+
+    TextLayout &layout = layouts[key];
+    BuildTextLayout(layout, font, text, fontSize, spacing, MeasureStringWidth(font, id, fontSize, spacing),
+                    GetStringLength(id));
+    return layout;
+}
+
+void DrawTextLayout(Font font, const TextLayout &layout, Vector2 position, Color tint)
+{
+    static std::vector<GlyphInstance> glyphs;
+    glyphs.clear();
+    for (const GlyphInstance &g : layout.glyphs)
+        glyphs.push_back({g.codepoint, {position.x + g.position.x, position.y + g.position.y}, g.fontSize, tint});
+
+    GfxDrawGlyphBatch(font, glyphs.data(), (int)glyphs.size());
+}
+
+void DrawCenteredText(Font font, const char *text, float y, float fontSize, float spacing, Color tint,
+                      float screenWidth)
+{
+    const TextLayout &layout = GetTextLayout(font, text, fontSize, spacing);
+    DrawTextLayout(font, layout, {(screenWidth - layout.width) / 2.0f, y}, tint);
+}
+
+void DrawCenteredText(Font font, StringId id, float y, float fontSize, float spacing, Color tint,
+                      float screenWidth)
+{
+    const TextLayout &layout = GetStringLayout(font, id, fontSize, spacing);
+    DrawTextLayout(font, layout, {(screenWidth - layout.width) / 2.0f, y}, tint);
+}
+
+// --- WORD WRAP ---
+
+static bool IsCJK(int codepoint)
+{
+    return (codepoint >= 0x2E80 && codepoint <= 0x9FFF) || // Radicals, punctuation, kana, ideographs
+           (codepoint >= 0xF900 && codepoint <= 0xFAFF) || // Compatibility ideographs
+           (codepoint >= 0xFF00 && codepoint <= 0xFFEF);   // Full-width forms
+}
+
+// Punctuation that can't start a line
+static bool IsClosing(int codepoint)
+{
+    static const int closing[] = {0x3001, 0x3002, 0xFF0C, 0xFF0E, 0xFF01, 0xFF1F, 0xFF1A, 0xFF1B,
+                                  0xFF09, 0x300D, 0x300F, 0x3011, 0x300B, 0x3009, 0x2026, 0xFF5E,
+                                  '!', '?', '.', ',', ':', ';', ')'};
+    for (int c : closing)
+    {
+        if (codepoint == c)
+            return true;
+    }
+    return false;
+}
+
+// Punctuation that can't end a line
+static bool IsOpening(int codepoint)
+{
+    return codepoint == 0xFF08 || codepoint == 0x300C || codepoint == 0x300E ||
+           codepoint == 0x3010 || codepoint == 0x300A || codepoint == 0x3008 || codepoint == '(';
+}
+
+// A break can go between prev and next without a space
+static bool CanBreakBetween(int prev, int next)
+{
+    return (IsCJK(prev) || IsCJK(next)) && !IsClosing(next) && !IsOpening(prev);
+}
+
+// Widths add up the way MeasureTextEx() does: advances, plus spacing between
+// codepoints
+static void BuildWrappedText(std::string &out, Font font, const char *text, float fontSize, float spacing, float maxWidth)
+{
+    std::vector<int> codepoints;
+    for (int i = 0; text[i] != '\0';)
+    {
+        int bytesProcessed = 0;
+        codepoints.push_back(GetCodepointNext(&text[i], &bytesProcessed));
+        i += bytesProcessed;
+    }
+
+    float lineWidth = 0.0f;
+    int lineCount = 0;
+    int breakAt = -1; // Last place this line can break
+    bool breakIsSpace = false;
+
+    for (int i = 0; i < (int)codepoints.size(); i++)
+    {
+        int codepoint = codepoints[i];
+        if (codepoint == '\n')
+        {
+            lineWidth = 0.0f;
+            lineCount = 0;
+            breakAt = -1;
+            continue;
+        }
+
+        if (codepoint != ' ' && lineCount > 0 && CanBreakBetween(codepoints[i - 1], codepoint))
+        {
+            breakAt = i;
+            breakIsSpace = false;
+        }
+
+        float width = lineWidth + ((lineCount > 0) ? spacing : 0.0f) + GetGlyphAdvance(font, fontSize, codepoint);
+
+        // Spaces may hang past the edge; the break goes on them later
+        if (width > maxWidth && lineCount > 0 && codepoint != ' ')
+        {
+            // One long word: split it here
+            if (breakAt < 0)
+            {
+                breakAt = i;
+                breakIsSpace = false;
+            }
+
+            if (breakIsSpace)
+                codepoints[breakAt] = '\n';
+            else
+                codepoints.insert(codepoints.begin() + breakAt, '\n');
+
+            // Carry on from the start of the new line
+            i = breakAt;
+            lineWidth = 0.0f;
+            lineCount = 0;
+            breakAt = -1;
+            continue;
+        }
+
+        if (codepoint == ' ' && lineCount > 0)
+        {
+            breakAt = i;
+            breakIsSpace = true;
+        }
+
+        lineWidth = width;
+        lineCount++;
+    }
+
+    out.clear();
+    for (int codepoint : codepoints)
+    {
+        int byteCount = 0;
+        const char *utf8 = CodepointToUTF8(codepoint, &byteCount);
+        out.append(utf8, byteCount);
+    }
+}
+
+const char *GetWrappedText(Font font, const char *text, float fontSize, float spacing, float maxWidth)
+{
+    CheckLanguage();
+
+    TextLayoutKey key = {text, font.texture.id, fontSize, spacing, maxWidth};
+    auto it = wrapped.find(key);
+    if (it != wrapped.end())
+        return it->second.c_str();
+
+    std::string &out = wrapped[key];
+    BuildWrappedText(out, font, text, fontSize, spacing, maxWidth);
+    return out.c_str();
+}
+
+void ClearTextLayoutCache()
+{
+    layouts.clear();
+    wrapped.clear();
+}
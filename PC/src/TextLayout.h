@@ -0,0 +1,46 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include "game_defs.h"
+#include "Render.h"
+#include "Strings.h"
+
+// --- RETAINED TEXT LAYOUT ---
+// Static UI strings (menu, tutorial, game over) are measured and laid out
+// once, then every frame just offsets the stored glyphs and draws them as
+// one batch. Layouts are keyed by font, size, spacing and the string's
+// address, so only pass strings that never change in place (literals, or
+// catalog strings). Everything is dropped when currentLanguage changes or
+// the fonts are unloaded.
+struct TextLayout
+{
+    float width; // Same as MeasureTextEx()
+    std::vector<GlyphInstance> glyphs; // Relative to the top-left corner, as DrawTextEx() places them
+};
+
+const TextLayout &GetTextLayout(Font font, const char *text, float fontSize, float spacing);
+
+// Draws a layout with its top-left corner at position
+void DrawTextLayout(Font font, const TextLayout &layout, Vector2 position, Color tint);
+
+// GetCenteredTextPosition() and GfxDrawTextEx() in one, from the cache
+void DrawCenteredText(Font font, const char *text, float y, float fontSize, float spacing, Color tint,
+                      float screenWidth = GAME_WIDTH);
+// Same for a catalog string; its layout is built from the catalog's width
+// and codepoint count
+void DrawCenteredText(Font font, StringId id, float y, float fontSize, float spacing, Color tint,
+                      float screenWidth = GAME_WIDTH);
+
+// --- WORD WRAP ---
+// text with line breaks added so no line is wider than maxWidth at this
+// font, size and spacing. Latin text breaks at spaces (the space becomes the
+// break), CJK text between any two characters, except before closing or
+// after opening punctuation; a word wider than the box is split where it
+// overflows. The script's own '\n's are kept. Cached like the layouts above,
+// so the same rules apply to text, and the result lives until the next
+// language change.
+const char *GetWrappedText(Font font, const char *text, float fontSize, float spacing, float maxWidth);
+
+void ClearTextLayoutCache();
+
+#endif
@@ -1,11 +1,18 @@
 #include "Utils.h"
 #include "Globals.h"
+#include "Input.h"
+#include "Render.h"
+#include "Sim.h"
+#include "GlyphCache.h"
 
 Typewriter globalTypewriter;
 
 // --- HELPER FUNCTION: Draw Text with Static Random Jitter ---
 // Updated to support Multi-byte UTF-8 Characters (Chinese)
-void DrawTextJitter(Font font, const char *text, Vector2 pos, float fontSize, float spacing, Color color)
+// Advances come from the glyph cache and each glyph is placed straight from
+// the font atlas, so no temp strings and no per-character MeasureTextEx.
+void AppendTextJitter(std::vector<GlyphInstance> &out, Font font, const char *text, Vector2 pos,
+                      float fontSize, float spacing, Color color, int byteCount)
 {
     float startX = pos.x;
     float currentX = pos.x;
@@ -14,7 +21,7 @@ void DrawTextJitter(Font font, const char *text, Vector2 pos, float fontSize, fl
     int i = 0; // Byte index
     int k = 0; // Character count (for random seed)
 
-    while (text[i] != '\0')
+    while (text[i] != '\0' && (byteCount < 0 || i < byteCount))
     {
         // 1. Get the codepoint and how many bytes it uses (1 for English, 3 for Chinese)
         int bytesProcessed = 0;
@@ -30,15 +37,7 @@ void DrawTextJitter(Font font, const char *text, Vector2 pos, float fontSize, fl
             continue;
         }
 
-        // 3. Extract the full Multi-byte character into a temp string
-        // Max UTF-8 length is 4 bytes, plus null terminator = 5
-        char tempStr[5] = {0};
-        for (int b = 0; b < bytesProcessed; b++)
-        {
-            tempStr[b] = text[i + b];
-        }
-
-        // 4. Deterministic Random Jitter Logic (Using 'k' instead of 'i')
+        // 3. Deterministic Random Jitter Logic (Using 'k' instead of 'i')
         // We use 'k' (character index) so the jitter stays consistent regardless of byte length
         int hashX = k * 43758 + 293;
         int hashY = k * 91238 + 582;
@@ -52,12 +51,12 @@ void DrawTextJitter(Font font, const char *text, Vector2 pos, float fontSize, fl
         // Apply offset
         Vector2 charPos = {currentX + ox, currentY + oy};
 
-        // Draw the full character (1-4 bytes)
-        DrawTextEx(font, tempStr, charPos, fontSize, spacing, color);
+        // Queue the glyph (DrawTextEx skips spaces and tabs too)
+        if (codepoint != ' ' && codepoint != '\t')
+            out.push_back({codepoint, charPos, fontSize, color});
 
-        // 5. Advance position by the REAL width of this specific character
-        Vector2 size = MeasureTextEx(font, tempStr, fontSize, spacing);
-        currentX += size.x + spacing; // Add spacing only between chars, not inside
+        // 4. Advance position by the REAL width of this specific character
+        currentX += GetGlyphAdvance(font, fontSize, codepoint) + spacing; // Add spacing only between chars, not inside
 
         // Advance to next character in the string
         i += bytesProcessed;
@@ -65,14 +64,58 @@ void DrawTextJitter(Font font, const char *text, Vector2 pos, float fontSize, fl
     }
 }
 
+// One batch per call
+void DrawTextJitter(Font font, const char *text, Vector2 pos, float fontSize, float spacing, Color color, int byteCount)
+{
+    static std::vector<GlyphInstance> glyphs;
+    glyphs.clear();
+    AppendTextJitter(glyphs, font, text, pos, fontSize, spacing, color, byteCount);
+    GfxDrawGlyphBatch(font, glyphs.data(), (int)glyphs.size());
+}
+
 void Typewriter::Start(const char *text, int speed)
 {
     fullText = text;
     speedMs = (float)speed / 1000.0f;
     charCount = 0;
+    glyphsShown = 0;
     timer = 0;
     active = true;
     finished = false;
+    MarkFrameDirty();
+
+    // Decode once. clear() keeps capacity, so after the first few lines
+    // starting a new one doesn't allocate either.
+    codepoints.clear();
+    byteOffsets.clear();
+    int i = 0;
+    while (fullText[i] != '\0')
+    {
+        int bytesProcessed = 0;
+        int codepoint = GetCodepointNext(&fullText[i], &bytesProcessed);
+        codepoints.push_back(codepoint);
+        byteOffsets.push_back(i);
+        i += bytesProcessed;
+    }
+    layoutValid = false;
+}
+
+void Typewriter::Reset()
+{
+    fullText.clear();
+    codepoints.clear();
+    byteOffsets.clear();
+    charCount = 0;
+    glyphsShown = 0;
+    active = false;
+    layoutValid = false;
+    MarkFrameDirty();
+}
+
+void Typewriter::Subscribe(TypewriterCharFn fn)
+{
+    if (listenerCount < TYPEWRITER_MAX_LISTENERS)
+        listeners[listenerCount++] = fn;
 }
 
 void Typewriter::Update()
@@ -80,73 +123,115 @@ void Typewriter::Update()
     if (!active || finished)
         return;
 
-    timer += GetFrameTime();
-    if (timer >= speedMs)
+    int glyphCount = (int)codepoints.size();
+    timer += GetGameFrameTime();
+
+    // Reveal every codepoint the elapsed time pays for and keep the remainder
+    while (glyphsShown < glyphCount && (speedMs <= 0.0f || timer >= speedMs))
     {
-        timer = 0;
+        if (speedMs > 0.0f)
+            timer -= speedMs;
 
-        // Safety check to prevent reading past the end
-        if (charCount < fullText.length())
-        {
-            int bytesProcessed = 0;
-            // Raylib helper: Peeks at the text and tells us if next char is 1, 2, 3, or 4 bytes
-            GetCodepointNext(&fullText[charCount], &bytesProcessed);
+        int codepoint = codepoints[glyphsShown];
+        glyphsShown++;
+        MarkFrameDirty();
 
-            // Advance by the FULL character length
-            charCount += bytesProcessed;
-        }
-        else
-        {
-            // Just in case we are somehow at the end
-            charCount++;
-        }
-
-        // Clamp to length
-        if (charCount > fullText.length())
-        {
-            charCount = fullText.length();
-        }
+        for (int i = 0; i < listenerCount; i++)
+            listeners[i](codepoint);
+    }
 
-        // Sound Logic (Checks the character *before* the current cursor)
-        if (charCount <= fullText.length() && charCount > 0)
-        {
-            // We look back at the previous character.
-            // Note: This naive check [charCount - 1] is risky with UTF-8,
-            // but since we only care about Space (' ') and Newline ('\n')
-            // which are ALWAYS 1 byte in UTF-8, this specific line is actually safe!
-            char prevChar = fullText[charCount - 1];
-
-            if (prevChar != ' ' && prevChar != '\n')
-            {
-                if (!IsSoundPlaying(sndText))
-                    PlaySound(sndText);
-            }
-        }
+    charCount = (glyphsShown < glyphCount) ? byteOffsets[glyphsShown] : (int)fullText.length();
 
-        if (charCount >= fullText.length())
-        {
-            charCount = fullText.length();
-            finished = true;
-        }
+    if (glyphsShown >= glyphCount)
+    {
+        timer = 0;
+        finished = true;
     }
 }
 
 void Typewriter::Skip()
 {
     charCount = fullText.length();
+    glyphsShown = (int)codepoints.size();
     finished = true;
+    MarkFrameDirty();
 }
 
 void Typewriter::Draw(Font font, int x, int y, float fontSize, float spacing, Color color)
 {
-    if (!active)
+    if (!active || glyphsShown == 0)
         return;
 
-    std::string sub = fullText.substr(0, charCount);
     Vector2 position = {(float)x, (float)y};
 
     // Standard straight drawing (Default)
-    DrawTextEx(font, sub.c_str(), position, fontSize, spacing, color);
+    GfxDrawTextCodepoints(font, codepoints.data(), glyphsShown, position, fontSize, spacing, color);
+}
+
+void Typewriter::DrawJitter(Font font, Vector2 pos, float fontSize, float spacing, Color color)
+{
+    if (!active)
+        return;
+
+    DrawTextJitter(font, fullText.c_str(), pos, fontSize, spacing, color, charCount);
+}
+
+void Typewriter::AppendJitter(std::vector<GlyphInstance> &out, Font font, Vector2 pos, float fontSize, float spacing, Color color)
+{
+    if (!active)
+        return;
+
+    AppendTextJitter(out, font, fullText.c_str(), pos, fontSize, spacing, color, charCount);
+}
+
+// Mirrors MeasureTextEx(): widest line's advances, plus spacing times the
+// longest line's codepoint count minus one (raylib tracks both separately).
+void Typewriter::BuildLayout(Font font, float fontSize, float spacing)
+{
+    if (layoutValid && layoutFontId == font.texture.id &&
+        layoutFontSize == fontSize && layoutSpacing == spacing)
+        return;
+
+    prefixWidths.resize(codepoints.size() + 1);
+    prefixWidths[0] = 0.0f;
+
+    float lineWidth = 0.0f, maxLineWidth = 0.0f;
+    int lineCount = 0, maxLineCount = 0;
+    for (size_t i = 0; i < codepoints.size(); i++)
+    {
+        lineCount++;
+        if (codepoints[i] == '\n')
+        {
+            if (maxLineWidth < lineWidth)
+                maxLineWidth = lineWidth;
+            lineWidth = 0.0f;
+            lineCount = 0;
+        }
+        else
+        {
+            lineWidth += GetGlyphAdvance(font, fontSize, codepoints[i]);
+        }
+        if (maxLineCount < lineCount)
+            maxLineCount = lineCount;
+
+        float widest = (maxLineWidth > lineWidth) ? maxLineWidth : lineWidth;
+        prefixWidths[i + 1] = widest + (float)(maxLineCount - 1) * spacing;
+    }
+
+    layoutFontId = font.texture.id;
+    layoutFontSize = fontSize;
+    layoutSpacing = spacing;
+    layoutValid = true;
+}
+
+float Typewriter::MeasureShownWidth(Font font, float fontSize, float spacing)
+{
+    // MeasureTextEx() returns zero for a font without a texture, so do we
+    if (glyphsShown == 0 || font.texture.id == 0)
+        return 0.0f;
+
+    BuildLayout(font, fontSize, spacing);
+    return prefixWidths[glyphsShown];
 }
 
 bool Typewriter::IsFinished()
@@ -154,12 +239,22 @@ bool Typewriter::IsFinished()
     return finished;
 }
 
+void PlayTextBlip(int codepoint)
+{
+    // No blip for whitespace
+    if (codepoint == ' ' || codepoint == '\n')
+        return;
+
+    if (!IsSoundPlaying(sndText))
+        PlaySound(sndText);
+}
+
 bool IsInteractPressed()
 {
-    return IsKeyPressed(KEY_Z) || IsKeyPressed(KEY_ENTER);
+    return IsGameKeyPressed(KEY_Z) || IsGameKeyPressed(KEY_ENTER);
 }
 
 bool IsCancelPressed()
 {
-    return IsKeyPressed(KEY_X) || IsKeyPressed(KEY_LEFT_SHIFT);
+    return IsGameKeyPressed(KEY_X) || IsGameKeyPressed(KEY_LEFT_SHIFT);
 }
\ No newline at end of file
@@ -2,34 +2,78 @@
 #define UTILS_H
 
 #include "game_defs.h"
+#include "Render.h"
+
+// Called once for every codepoint the typewriter reveals
+typedef void (*TypewriterCharFn)(int codepoint);
+
+#define TYPEWRITER_MAX_LISTENERS 4
 
 // Non-blocking Typewriter class
+// Start() decodes the UTF-8 text once into per-codepoint tables, so drawing or
+// measuring the visible prefix never allocates or rescans the string.
+// Update() accumulates elapsed time and reveals as many codepoints as it
+// covers, so text speed is the same at any frame rate.
 class Typewriter
 {
 public:
     std::string fullText;
-    int charCount;
-    float timer;
-    float speedMs;
+    int charCount;   // Visible prefix in BYTES of fullText
+    int glyphsShown; // Visible prefix in CODEPOINTS
+    float timer;   // Time accumulated towards the next codepoint
+    float speedMs; // Seconds per codepoint (0 = whole line at once)
     bool active;
     bool finished;
 
+    // Per-codepoint tables, filled by Start()
+    std::vector<int> codepoints;
+    std::vector<int> byteOffsets; // Start of each codepoint in fullText
+
+    void Subscribe(TypewriterCharFn fn);
+
     void Start(const char *text, int speed);
+    void Reset(); // Empty and inactive
     void Update();
 
-    // Draws text with a static vertical offset per character
+    // Draws the visible prefix straight
     void Draw(Font font, int x, int y, float fontSize, float spacing, Color color);
+    // Draws the visible prefix through DrawTextJitter
+    void DrawJitter(Font font, Vector2 pos, float fontSize, float spacing, Color color);
+    // Queues the same glyphs as DrawJitter into a batch
+    void AppendJitter(std::vector<GlyphInstance> &out, Font font, Vector2 pos, float fontSize, float spacing, Color color);
+    // Same as MeasureTextEx(...).x on the visible prefix
+    float MeasureShownWidth(Font font, float fontSize, float spacing);
 
     bool IsFinished();
     void Skip();
+
+private:
+    TypewriterCharFn listeners[TYPEWRITER_MAX_LISTENERS] = {};
+    int listenerCount = 0;
+
+    // MeasureTextEx() width of every prefix, for one font/size/spacing at a time
+    std::vector<float> prefixWidths;
+    unsigned int layoutFontId;
+    float layoutFontSize;
+    float layoutSpacing;
+    bool layoutValid;
+
+    void BuildLayout(Font font, float fontSize, float spacing);
 };
 
 extern Typewriter globalTypewriter;
 
+// Typewriter listener: the sndText blip for every visible character
+void PlayTextBlip(int codepoint);
+
 // Helper to check for "Interact" key (Z or Enter)
 bool IsInteractPressed();
 bool IsCancelPressed();
 
 // --- RENDERING HELPERS ---
-void DrawTextJitter(Font font, const char *text, Vector2 pos, float fontSize, float spacing, Color color);
+// byteCount limits drawing to a prefix of text (-1 = whole string)
+void DrawTextJitter(Font font, const char *text, Vector2 pos, float fontSize, float spacing, Color color, int byteCount = -1);
+// Queues the glyphs DrawTextJitter would draw, for a batch shared by several texts
+void AppendTextJitter(std::vector<GlyphInstance> &out, Font font, const char *text, Vector2 pos,
+                      float fontSize, float spacing, Color color, int byteCount = -1);
 #endif
\ No newline at end of file
@@ -4,7 +4,23 @@
 #include "Utils.h"
 #include "Player.h"
 #include "Battle.h"
-#include "TextAlignment.h"
+#include "TextLayout.h"
+#include "Input.h"
+#include "Render.h"
+#include "Sim.h"
+#include "Fonts.h"
+#include "AllocCounter.h"
+#include "AssetLoader.h"
+#include "Dialogue.h"
+#include "CoffeeLog.h"
+#include "CollisionMap.h"
+#include "Replay.h"
+#include "MusicThread.h"
+#include "PerfHud.h"
+#include "Profiler.h"
+#include "Strings.h"
+#include <chrono>
+#include <cstdio>
 #include <vector>
 #include <string>
 #include <cmath>
@@ -12,21 +28,13 @@
 const bool DEBUG_SKIP_TO_BATTLE = false;
 
 // --- MAIN VARIABLES ---
-DialogueState currentDialogueState = D_INTRO_1;
+int currentDialogueNode = 0; // Index into the dialogue script (Dialogue.h)
 Inventory playerInventory = {true, true, true};
 
 // Map Data
-std::vector<Rect> walkableFloors = {
-    // top section to the chair top
-    {135, 227, 583, 32},
-    {135, 259, 527, 17},
-    {135, 276, 489, 36},
-    // middle
-    {125, 312, 503, 29},
-    {114, 341, 547, 41},
-    // bottom section
-    {104, 382, 615, 39},
-    {136, 421, 583, 52}};
+// Baked from assets/background_walk.png, loaded by InitGame()
+std::vector<Rect> walkableFloors;
+CollisionMask walkableMask;
 
 NPC mapEnemy = {425, 280};
 
@@ -49,17 +57,7 @@ int playerChoiceYesNo = 0;
 int itemUsedIndex = 0;
 
 // --- COFFEE EVENT DATA ---
-struct LogEntry
-{
-    std::string text;
-    Color color;
-    int shakeIntensity; // 0 = None, 1 = Low, 2 = Medium, 3+ = High
-    bool centered;      // true = Center on screen, false = Left aligned
-    float spacing;      // Space after this line (default 10)
-    bool isChaotic;
-};
-
-std::vector<LogEntry> coffeeLog;
+CoffeeLog coffeeLog;
 
 // State tracking
 int coffeeScriptStep = 0;
@@ -80,96 +78,117 @@ Font myCustomFont;
 
 bool IsLeftPressed()
 {
-    return IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A);
+    return IsGameKeyPressed(KEY_LEFT) || IsGameKeyPressed(KEY_A);
 }
 
 bool IsRightPressed()
 {
-    return IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D);
+    return IsGameKeyPressed(KEY_RIGHT) || IsGameKeyPressed(KEY_D);
 }
 
 // --- STATE HANDLERS ---
 
+// While the loader is running a font may not be uploaded yet
+static Font MenuFont(Font font)
+{
+    return (font.texture.id != 0 || IsAssetLoaderDone()) ? font : gameFont;
+}
+
 void HandleMenu()
 {
-    if (!IsMusicStreamPlaying(menuMusic))
+    PROFILE_ZONE("HandleMenu");
+
+    if (!IsMusicPlaying(MUSIC_MENU))
     {
-        PlayMusicStream(menuMusic);
+        PlayMusic(MUSIC_MENU);
     }
-    UpdateMusicStream(menuMusic);
+
+    // The menu doubles as the boot screen: it is up from the first frame and
+    // takes input once every asset is loaded
+    bool loading = !IsAssetLoaderDone();
 
     // --- 1. LANGUAGE SELECTION INPUT ---
-    if (IsKeyPressed(KEY_ONE))
+    if (loading)
+    {
+        // Wait for the loader
+    }
+    else if (IsGameKeyPressed(KEY_ONE))
     {
         PlaySound(sndSelect);
-        currentLanguage = LANG_EN;
+        SetLanguage(LANG_EN);
     }
-    if (IsKeyPressed(KEY_TWO))
+    else if (IsGameKeyPressed(KEY_TWO))
     {
         PlaySound(sndSelect);
-        currentLanguage = LANG_CN;
+        SetLanguage(LANG_CN);
     }
 
     // --- 2. GET CURRENT FONT & COLORS ---
-    Font activeFont = GetCurrentFont();
+    Font activeFont = MenuFont(GetCurrentFont());
+    Font menuFontEN = MenuFont(fontEN);
     Color enColor = (currentLanguage == LANG_EN) ? YELLOW : GRAY;
     Color cnColor = (currentLanguage == LANG_CN) ? YELLOW : GRAY;
 
     // --- 3. DRAW TITLE (Dynamic Language) ---
-    const char *titleStr = Text("UNDERTILE", "傳說之下水道");
     if (currentLanguage == LANG_EN)
     {
-        TextMetrics titleM = GetCenteredTextPosition(activeFont, titleStr, 60, 2);
-        DrawTextEx(activeFont, titleStr, {titleM.x, 150}, 60, 2, WHITE);
+        DrawCenteredText(activeFont, STR_MENU_TITLE, 150, 60, 2, WHITE);
     }
     else
     {
-        TextMetrics titleM = GetCenteredTextPosition(activeFont, titleStr, 76, 2);
-        DrawTextEx(activeFont, titleStr, {titleM.x, 150}, 76, 2, WHITE);
+        DrawCenteredText(activeFont, STR_MENU_TITLE, 150, 76, 2, WHITE);
     }
 
     // --- 4. DRAW LANGUAGE OPTIONS (Fixed Fonts) ---
-    const char *optEn = "PRESS [1] FOR ENGLISH";
-    TextMetrics enM = GetCenteredTextPosition(fontEN, optEn, 25, 2);
-    DrawTextEx(fontEN, optEn, {enM.x, 310}, 25, 2, enColor);
+    DrawCenteredText(menuFontEN, STR_MENU_ENGLISH, 310, 25, 2, enColor);
 
-    const char *optCn = "按 [2] 切換中文";
-    TextMetrics cnM = GetCenteredTextPosition(fontCN, optCn, 32, 2);
-    DrawTextEx(fontCN, optCn, {cnM.x, 350}, 32, 2, cnColor);
+    // The default font has no CJK glyphs, so this waits for fontCN
+    if (!loading || fontCN.texture.id != 0)
+    {
+        DrawCenteredText(fontCN, STR_MENU_CHINESE, 350, 32, 2, cnColor);
+    }
 
     // --- 5. DRAW ENTER PROMPT (Dynamic Language) ---
-    const char *enterStr = Text("Press Z to Enter", "按Z進入遊戲");
-    if (currentLanguage == LANG_EN)
+    if (loading)
+    {
+        // Progress bar in place of the prompt
+        float progress = GetAssetLoaderProgress();
+        Rectangle bar = {GAME_WIDTH / 2 - 150, 455, 300, 20};
+        GfxDrawRectangleLinesEx(bar, 2, GRAY);
+        GfxDrawRectangleRec({bar.x + 4, bar.y + 4, (bar.width - 8) * progress, bar.height - 8}, WHITE);
+    }
+    else if (currentLanguage == LANG_EN)
     {
-        TextMetrics titleM = GetCenteredTextPosition(activeFont, enterStr, 30, 2);
-        DrawTextEx(activeFont, enterStr, {titleM.x, 450}, 30, 2, WHITE);
+        DrawCenteredText(activeFont, STR_MENU_ENTER, 450, 30, 2, WHITE);
     }
     else
     {
-        TextMetrics titleM = GetCenteredTextPosition(activeFont, enterStr, 38, 2);
-        DrawTextEx(activeFont, enterStr, {titleM.x, 450}, 38, 2, WHITE);
+        DrawCenteredText(activeFont, STR_MENU_ENTER, 450, 38, 2, WHITE);
     }
 
     // --- 6. CREDITS ---
-    TextMetrics creditM = GetCenteredTextPosition(fontEN, "By Molly", 20, 2);
-    DrawTextEx(fontEN, "By Molly", {creditM.x, 600}, 20, 2, DARKGRAY);
+    DrawCenteredText(menuFontEN, STR_MENU_CREDITS, 600, 20, 2, DARKGRAY);
 
     // --- 7. START GAME ---
-    if (IsInteractPressed())
+    if (!loading && IsInteractPressed())
     {
         PlaySound(sndSelect);
-        StopMusicStream(menuMusic);
+        StopMusic(MUSIC_MENU);
         currentState = MAP_WALK;
         player.Init(125, 300);
-        player.SetZones(walkableFloors);
+        player.SetZones(walkableFloors, walkableMask);
         storyProgress = 0;
         isStateFirstFrame = true;
     }
 }
 
+void EnterDialogueNode(int index);
+
 void HandleMap()
 {
-    float dt = GetFrameTime();
+    PROFILE_ZONE("HandleMap");
+
+    float dt = GetGameFrameTime();
 
     if (interactionCooldown > 0)
         interactionCooldown -= dt;
@@ -185,124 +204,65 @@ void HandleMap()
         currentState = DIALOGUE;
 
         // Ensure the typewriter is empty and inactive before the first Draw frame.
-        globalTypewriter.fullText = "";
-        globalTypewriter.charCount = 0;
-        globalTypewriter.active = false;
+        globalTypewriter.Reset();
 
         if (battleCompleted)
-            currentDialogueState = D_POST_BATTLE;
+            EnterDialogueNode(FindDialogueNode("POST_BATTLE"));
         else if (storyProgress == 0)
-            currentDialogueState = D_INTRO_1; // DEBUG: D_COFFEE_EVENT
+            EnterDialogueNode(FindDialogueNode("INTRO_1")); // DEBUG: COFFEE_EVENT
         else if (storyProgress == 1)
-            currentDialogueState = D_REQUEST_FOOD_PART1;
+            EnterDialogueNode(FindDialogueNode("REQUEST_FOOD_PART1"));
         else
-            currentDialogueState = D_REQUEST_FOOD;
-
-        isStateFirstFrame = true;
+            EnterDialogueNode(FindDialogueNode("REQUEST_FOOD"));
     }
 
-    DrawTexture(texBackground, 0, 0, WHITE);
-    DrawTexture(texRobot, (int)mapEnemy.x, (int)mapEnemy.y, WHITE);
+    GfxDrawTexture(texBackground, 0, 0, WHITE);
+    GfxDrawTexture(texRobot, (int)mapEnemy.x, (int)mapEnemy.y, WHITE);
     player.Draw();
     if (showTutorialText)
     {
         Font activeFont = GetCurrentFont();
-        const char *guideText;
-        float fontSize;
-
-        if (currentLanguage == LANG_EN)
-        {
-            guideText = "[Arrow Keys] Move   [Z] Interact with Robot";
-            fontSize = 23.0f;
-        }
-        else
-        {
-            guideText = "[方向鍵] 移動   [Z] 與機器人互動";
+        float fontSize = 23.0f;
+        if (currentLanguage == LANG_CN)
             fontSize = 30.0f; // Slightly larger for Chinese readability
-        }
 
         // Center the text
-        TextMetrics tm = GetCenteredTextPosition(activeFont, guideText, fontSize, 2.0f);
-        DrawTextEx(activeFont, guideText, {tm.x, GAME_HEIGHT - 40.0f}, fontSize, 2.0f, WHITE);
+        DrawCenteredText(activeFont, STR_MAP_TUTORIAL, GAME_HEIGHT - 40.0f, fontSize, 2.0f, WHITE);
     }
 }
 
-void StartDialogue(const char *text, int speed, float waitTime)
-{
-    globalTypewriter.Start(text, speed);
-    dialogTimer = waitTime;
-    isStateFirstFrame = false;
-}
-
 void HandleCoffeeEvent()
 {
-    float dt = GetFrameTime();
+    PROFILE_ZONE("HandleCoffeeEvent");
+
+    // Flashing background and chaotic text change every tick
+    MarkFrameDirty();
+    float dt = GetGameFrameTime();
     if (coffeeTimer > 0)
         coffeeTimer -= dt;
 
-    // Pick English or Chinese line depending on currentLanguage
-    auto L = [&](const char *en, const char *cn)
-    {
-        return (currentLanguage == LANG_CN) ? cn : en;
-    };
-
     // Special lines
-    const char *controlLine = L("I CANNOT CONTROL THE OUTPUT!", "我控制不了我的輸出了!");
-    const char *deleteLine = L("CTRL+ALT+DELETE ME!", "把我強制關機!");
+    const char *controlLine = Str(STR_COFFEE_CONTROL);
+    const char *deleteLine = Str(STR_COFFEE_DELETE);
 
     // --- FLASHING BACKGROUND LOGIC ---
-    ClearBackground(bgColor);
+    GfxClearBackground(bgColor);
     if (bgColor.r != 0 || bgColor.g != 0)
     {
         if (bgColor.r == 255 && coffeeTimer < 0.05f)
-            ClearBackground(BLACK);
+            GfxClearBackground(BLACK);
         else
-            ClearBackground(bgColor);
+            GfxClearBackground(bgColor);
     }
 
     // --- DRAWING LOGIC ---
     float startX = 50.0f;
-    float currentY = 125.0f;
     float baseFontSize = (currentLanguage == LANG_CN) ? 45.0f : 40.0f;
-    ;
     float fontSpacing = 1.5f;
     Font activeFont = GetCurrentFont();
 
-    // 1. Draw history
-    for (size_t i = 0; i < coffeeLog.size(); i++)
-    {
-        float drawX = startX;
-        float fontSize = baseFontSize;
-        float drawY = currentY;
-
-        // overlay hack: keep control line locked in the middle
-        if (coffeeLog[i].text == controlLine)
-            drawY = 290.0f;
-
-        if (coffeeLog[i].centered)
-        {
-            Vector2 size = MeasureTextEx(activeFont, coffeeLog[i].text.c_str(), fontSize, fontSpacing);
-            drawX = (GAME_WIDTH - size.x) / 2.0f;
-        }
-
-        if (coffeeLog[i].isChaotic)
-        {
-            DrawTextJitter(activeFont, coffeeLog[i].text.c_str(), {drawX - 2, drawY + 1}, fontSize, fontSpacing, BLUE);
-            DrawTextJitter(activeFont, coffeeLog[i].text.c_str(), {drawX + 2, drawY - 1}, fontSize, fontSpacing, GREEN);
-            DrawTextJitter(activeFont, coffeeLog[i].text.c_str(), {drawX, drawY}, fontSize, fontSpacing, RED);
-        }
-        else if (coffeeLog[i].shakeIntensity > 0)
-        {
-            DrawTextJitter(activeFont, coffeeLog[i].text.c_str(), {drawX, drawY}, fontSize, fontSpacing, coffeeLog[i].color);
-        }
-        else
-        {
-            DrawTextEx(activeFont, coffeeLog[i].text.c_str(), {drawX, drawY}, fontSize, fontSpacing, coffeeLog[i].color);
-        }
-
-        Vector2 size = MeasureTextEx(activeFont, coffeeLog[i].text.c_str(), fontSize, fontSpacing);
-        currentY += size.y + coffeeLog[i].spacing;
-    }
+    // 1. Draw history (control line locked in the middle)
+    float currentY = coffeeLog.Draw(activeFont, startX, 125.0f, baseFontSize, fontSpacing, controlLine, 290.0f);
 
     // 2. Draw active typewriter
     globalTypewriter.Update();
@@ -315,6 +275,10 @@ void HandleCoffeeEvent()
             int repeatCount = (currentLanguage == LANG_CN) ? 70 : 60;
             int rangeX_var = (currentLanguage == LANG_CN) ? 100 : -150;
             int rangeY_var = (currentLanguage == LANG_CN) ? -50 : 20;
+
+            // Every copy goes into one batch, a single draw call
+            static std::vector<GlyphInstance> flood;
+            flood.clear();
             for (int k = 0; k < repeatCount; k++)
             {
                 int rawX = (k * 314159 + 12345);
@@ -327,9 +291,9 @@ void HandleCoffeeEvent()
                     py += rangeY;
 
                 float rSize = 30.0f + ((k * 13) % 25);
-                std::string sub = globalTypewriter.fullText.substr(0, globalTypewriter.charCount);
-                DrawTextJitter(GetCurrentFont(), sub.c_str(), {(float)px, (float)py}, rSize, fontSpacing, RED);
+                globalTypewriter.AppendJitter(flood, activeFont, {(float)px, (float)py}, rSize, fontSpacing, RED);
             }
+            GfxDrawGlyphBatch(activeFont, flood.data(), (int)flood.size());
         }
         else
         {
@@ -343,23 +307,20 @@ void HandleCoffeeEvent()
 
             if (currentCentered)
             {
-                std::string sub = globalTypewriter.fullText.substr(0, globalTypewriter.charCount);
-                Vector2 size = MeasureTextEx(activeFont, sub.c_str(), fontSize, fontSpacing);
-                activeX = (GAME_WIDTH - size.x) / 2.0f;
+                float width = globalTypewriter.MeasureShownWidth(activeFont, fontSize, fontSpacing);
+                activeX = (GAME_WIDTH - width) / 2.0f;
             }
 
             if (currentChaotic)
             {
                 fontSize += GetRandomValue(-5, 5) / 10.0f;
-                std::string sub = globalTypewriter.fullText.substr(0, globalTypewriter.charCount);
-                DrawTextJitter(activeFont, sub.c_str(), {activeX - 6, activeY + 3}, fontSize, fontSpacing, BLUE);
-                DrawTextJitter(activeFont, sub.c_str(), {activeX + 6, activeY - 3}, fontSize, fontSpacing, GREEN);
-                DrawTextJitter(activeFont, sub.c_str(), {activeX, activeY}, fontSize, fontSpacing, RED);
+                globalTypewriter.DrawJitter(activeFont, {activeX - 6, activeY + 3}, fontSize, fontSpacing, BLUE);
+                globalTypewriter.DrawJitter(activeFont, {activeX + 6, activeY - 3}, fontSize, fontSpacing, GREEN);
+                globalTypewriter.DrawJitter(activeFont, {activeX, activeY}, fontSize, fontSpacing, RED);
             }
             else if (currentShakeIntensity > 0)
             {
-                std::string sub = globalTypewriter.fullText.substr(0, globalTypewriter.charCount);
-                DrawTextJitter(activeFont, sub.c_str(), {activeX, activeY}, fontSize, fontSpacing, currentTextColor);
+                globalTypewriter.DrawJitter(activeFont, {activeX, activeY}, fontSize, fontSpacing, currentTextColor);
             }
             else
             {
@@ -369,12 +330,12 @@ void HandleCoffeeEvent()
     }
 
     // 3. Script logic
-    auto AdvanceStep = [&](const char *nextEn, const char *nextCn, int speed, float wait,
+    auto AdvanceStep = [&](StringId next, int speed, float wait,
                            Color nextColor, int nextShake, bool nextCentered, float nextSpacing, bool nextChaotic)
     {
         if (!globalTypewriter.fullText.empty())
         {
-            coffeeLog.push_back({globalTypewriter.fullText,
+            coffeeLog.Push({globalTypewriter.fullText,
                                  currentTextColor,
                                  currentShakeIntensity,
                                  currentCentered,
@@ -388,7 +349,7 @@ void HandleCoffeeEvent()
         currentSpacing = nextSpacing;
         currentChaotic = nextChaotic;
 
-        globalTypewriter.Start(L(nextEn, nextCn), speed);
+        globalTypewriter.Start(Str(next), speed);
         coffeeTimer = wait;
         coffeeScriptStep++;
     };
@@ -396,7 +357,7 @@ void HandleCoffeeEvent()
     switch (coffeeScriptStep)
     {
     case 0:
-        if (coffeeLog.empty() && !globalTypewriter.active)
+        if (coffeeLog.Empty() && !globalTypewriter.active)
         {
             currentTextColor = WHITE;
             currentShakeIntensity = 0;
@@ -404,9 +365,7 @@ void HandleCoffeeEvent()
             currentSpacing = 30.0f;
             currentChaotic = false;
 
-            globalTypewriter.Start(
-                L("THANKS! SLURP...", "謝謝！【吸溜】"),
-                50);
+            globalTypewriter.Start(Str(STR_COFFEE_THANKS), 50);
             coffeeScriptStep++;
         }
         break;
@@ -421,24 +380,24 @@ void HandleCoffeeEvent()
 
     case 2:
         if (coffeeTimer <= 0)
-            AdvanceStep("Analyzing...", "分析中...", 50, 1.0f, WHITE, 0, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_ANALYZING, 50, 1.0f, WHITE, 0, false, 30.0f, false);
         break;
 
     case 3:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
-            AdvanceStep("Is this C8H10N4O2?", "這是C8H10N4O2嗎?", 50, 1.0f, WHITE, 0, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_CAFFEINE, 50, 1.0f, WHITE, 0, false, 30.0f, false);
         break;
 
     case 4:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
-            AdvanceStep("Was that... COFFEE?", "這是...咖啡嗎?", 70, 2.0f, WHITE, 1, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_WAS_THAT, 70, 2.0f, WHITE, 1, false, 30.0f, false);
         break;
 
     case 5:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
-            AdvanceStep("Oh no.", "不行。", 50, 1.0f, WHITE, 1, false, 30.0f, false);
-            coffeeLog.clear();
+            AdvanceStep(STR_COFFEE_OH_NO, 50, 1.0f, WHITE, 1, false, 30.0f, false);
+            coffeeLog.Clear();
         }
         break;
 
@@ -446,20 +405,20 @@ void HandleCoffeeEvent()
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
             PlaySound(sndDialup[0]);
-            AdvanceStep("Oh no no no.", "完蛋了完蛋了。", 50, 1.0f, WHITE, 1, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_OH_NO_NO, 50, 1.0f, WHITE, 1, false, 30.0f, false);
         }
         break;
 
     case 7:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
-            AdvanceStep("Doctor explicitly said:", "博士明確地說過：", 50, 1.75f, WHITE, 1, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_DOCTOR, 50, 1.75f, WHITE, 1, false, 30.0f, false);
         break;
 
     case 8:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
             PlaySound(sndDialup[1]);
-            AdvanceStep("NO. OVERCLOCKING.", "不能。過度運轉。", 70, 2.0f, RED, 1, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_OVERCLOCKING, 70, 2.0f, RED, 1, false, 30.0f, false);
         }
         break;
 
@@ -467,41 +426,40 @@ void HandleCoffeeEvent()
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
             PlaySound(sndDialup[2]);
-            AdvanceStep("My Clock Frequency is\nreaching 800 MHz.",
-                        "我的運行頻率已經達到800 MHz", 40, 1.0f, WHITE, 2, false, 30.0f, false);
-            coffeeLog.clear();
+            AdvanceStep(STR_COFFEE_CLOCK, 40, 1.0f, WHITE, 2, false, 30.0f, false);
+            coffeeLog.Clear();
         }
         break;
 
     case 10:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
-            AdvanceStep("I can see sounds.", "我可以看見聲音", 40, 1.0f, WHITE, 2, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_SOUNDS, 40, 1.0f, WHITE, 2, false, 30.0f, false);
         break;
 
     case 11:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
-            AdvanceStep("I can taste math.", "我可以嚐到數學", 40, 1.0f, WHITE, 2, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_MATH, 40, 1.0f, WHITE, 2, false, 30.0f, false);
         break;
 
     case 12:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
             PlaySound(sndDialup[3]);
-            AdvanceStep("My CPU hurts...", "我的CPU好痛...", 60, 1.5f, WHITE, 3, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_CPU, 60, 1.5f, WHITE, 3, false, 30.0f, false);
         }
         break;
 
     case 13:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
-            AdvanceStep("The fan... it stopped...", "散熱風扇...停止運作了...", 80, 2.0f, WHITE, 3, false, 30.0f, false);
+            AdvanceStep(STR_COFFEE_FAN, 80, 2.0f, WHITE, 3, false, 30.0f, false);
         break;
 
     case 14:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
             PlaySound(sndDialup[4]);
-            AdvanceStep("W H A T", "你", 80, 0.6f, RED, 3, true, 30.0f, false);
-            coffeeLog.clear();
+            AdvanceStep(STR_COFFEE_WHAT, 80, 0.6f, RED, 3, true, 30.0f, false);
+            coffeeLog.Clear();
         }
         break;
 
@@ -509,7 +467,7 @@ void HandleCoffeeEvent()
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
             PlaySound(sndDialup[4]);
-            AdvanceStep("H A V E", "做了", 80, 0.6f, RED, 3, true, 30.0f, false);
+            AdvanceStep(STR_COFFEE_HAVE, 80, 0.6f, RED, 3, true, 30.0f, false);
         }
         break;
 
@@ -517,7 +475,7 @@ void HandleCoffeeEvent()
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
             PlaySound(sndDialup[4]);
-            AdvanceStep("Y O U", "什麼？", 80, 0.6f, RED, 3, true, 30.0f, false);
+            AdvanceStep(STR_COFFEE_YOU, 80, 0.6f, RED, 3, true, 30.0f, false);
         }
         break;
 
@@ -530,25 +488,24 @@ void HandleCoffeeEvent()
                 PlaySound(sndDialup[4]);
                 wait = 2.0f;
             }
-            AdvanceStep("D O N E ?", "", 80, wait, RED, 3, true, 30.0f, false);
+            AdvanceStep(STR_COFFEE_DONE, 80, wait, RED, 3, true, 30.0f, false);
         }
         break;
 
     case 18:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
-            AdvanceStep("I CANNOT CONTROL THE OUTPUT!", "我控制不了我的輸出了!", 30, 1.0f,
-                        RED, 3, true, 30.0f, false);
+            AdvanceStep(STR_COFFEE_CONTROL, 30, 1.0f, RED, 3, true, 30.0f, false);
         break;
 
     case 19:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
-            AdvanceStep("P L E A S E", "請你", 30, 1.5f, RED, 3, true, 30.0f, true);
+            AdvanceStep(STR_COFFEE_PLEASE, 30, 1.5f, RED, 3, true, 30.0f, true);
         break;
 
     case 20:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
-            coffeeLog.push_back({globalTypewriter.fullText, RED, 3, false, 30.0f, true});
+            coffeeLog.Push({globalTypewriter.fullText, RED, 3, false, 30.0f, true});
             globalTypewriter.active = false;
             bgColor = RED;
             coffeeTimer = 0.2f;
@@ -559,7 +516,7 @@ void HandleCoffeeEvent()
     case 21: // flash twice
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
-            coffeeLog.push_back({globalTypewriter.fullText, RED, 3, false, 30.0f, true});
+            coffeeLog.Push({globalTypewriter.fullText, RED, 3, false, 30.0f, true});
             globalTypewriter.active = false;
             bgColor = RED;
             coffeeTimer = 0.2f;
@@ -571,7 +528,7 @@ void HandleCoffeeEvent()
         if (coffeeTimer <= 0)
         {
             bgColor = BLACK;
-            coffeeLog.clear();
+            coffeeLog.Clear();
             PlaySound(sndDialup[5]);
             globalTypewriter.Start(deleteLine, 20);
 
@@ -589,7 +546,7 @@ void HandleCoffeeEvent()
     case 23:
         if (globalTypewriter.IsFinished() && coffeeTimer <= 0)
         {
-            coffeeLog.clear();
+            coffeeLog.Clear();
             preBattleX = player.pos.x;
             preBattleY = player.pos.y;
             currentState = BATTLE;
@@ -604,13 +561,99 @@ void HandleCoffeeEvent()
     }
 }
 
+// --- DIALOGUE ENGINE ---
+// Runs the compiled dialogue script (Dialogue.h), one node at a time
+
+static void LeaveDialogue()
+{
+    currentState = MAP_WALK;
+    interactionCooldown = 0.2f;
+    isStateFirstFrame = true;
+}
+
+// Script variables live in the game globals
+static int *GetDialogueVar(int var)
+{
+    switch (var)
+    {
+    case DVAR_CHOICE:
+        return &playerChoiceYesNo;
+    case DVAR_STORY:
+        return &storyProgress;
+    case DVAR_ITEM:
+        return &itemUsedIndex;
+    default:
+        return nullptr;
+    }
+}
+
+static void RunDialogueAction(const DialogueNode *node, int when)
+{
+    int *var = GetDialogueVar(node->actionVar);
+    if (var == nullptr || node->actionWhen != when)
+        return;
+
+    if (node->actionOp == DOP_SET)
+        *var = node->actionValue;
+    if (node->actionOp == DOP_ADD)
+    {
+        *var += node->actionValue;
+        if (*var > node->actionMax)
+            *var = node->actionMax;
+    }
+}
+
+static void StartCoffeeEvent()
+{
+    coffeeScriptStep = 0;
+    coffeeTimer = 0.0f;
+    coffeeLog.Clear();
+    bgColor = BLACK;
+    globalTypewriter.active = false;
+}
+
+void EnterDialogueNode(int index)
+{
+    const DialogueNode *node = GetDialogueNode(index);
+    if (node == nullptr)
+    {
+        TraceLog(LOG_WARNING, "Dialogue node %d missing, leaving dialogue", index);
+        LeaveDialogue();
+        return;
+    }
+
+    currentDialogueNode = index;
+    isStateFirstFrame = true;
+    if (node->type == DNODE_EVENT && node->event == DEVENT_COFFEE)
+        StartCoffeeEvent();
+}
+
+// Z on a finished node: run its exit action, follow next
+static void FollowDialogue(const DialogueNode *node, int next)
+{
+    RunDialogueAction(node, DWHEN_NEXT);
+    if (next == DIALOGUE_EXIT)
+        LeaveDialogue();
+    else
+        EnterDialogueNode(next);
+}
+
 void HandleDialogue()
 {
-    float dt = GetFrameTime();
+    PROFILE_ZONE("HandleDialogue");
+
+    float dt = GetGameFrameTime();
     if (dialogTimer > 0)
         dialogTimer -= dt;
 
-    if (currentDialogueState == D_COFFEE_EVENT)
+    const DialogueNode *node = GetDialogueNode(currentDialogueNode);
+    if (node == nullptr)
+    {
+        LeaveDialogue();
+        return;
+    }
+
+    if (node->type == DNODE_EVENT)
     {
         HandleCoffeeEvent();
         return;
@@ -619,21 +662,20 @@ void HandleDialogue()
     // --- PRESS X TO CLOSE ---
     if (IsCancelPressed())
     {
-        currentState = MAP_WALK;
-        interactionCooldown = 0.2f;
-        isStateFirstFrame = true;
+        LeaveDialogue();
         return;
     }
 
-    DrawTexture(texBackground, 0, 0, WHITE);
-    DrawTexture(texRobot, (int)mapEnemy.x, (int)mapEnemy.y, WHITE);
+    GfxDrawTexture(texBackground, 0, 0, WHITE);
+    GfxDrawTexture(texRobot, (int)mapEnemy.x, (int)mapEnemy.y, WHITE);
     player.Draw();
     int printSpeed = (currentLanguage == LANG_CN) ? 50.0f : 30.0f;
+    int column = (currentLanguage == LANG_CN) ? DIALOGUE_COL_CN : DIALOGUE_COL_EN;
 
     // Box
     Rectangle box = {25, 450, 750, 200};
-    DrawRectangleRec(box, BLACK);
-    DrawRectangleLinesEx(box, 4, WHITE);
+    GfxDrawRectangleRec(box, BLACK);
+    GfxDrawRectangleLinesEx(box, 4, WHITE);
 
     // slightly bigger for Chinese
     float dialogueFontSize = (currentLanguage == LANG_CN) ? 35.0f : 30.0f;
@@ -664,323 +706,114 @@ void HandleDialogue()
         }
     }
 
-    // Helper: choose EN/CN text
-    auto L = [&](const char *en, const char *cn)
-    {
-        return (currentLanguage == LANG_CN) ? cn : en;
-    };
-
-    switch (currentDialogueState)
-    {
-    // ---------------- INTRO ----------------
-    case D_INTRO_1:
-        if (isStateFirstFrame)
-            StartDialogue(
-                L("* AAAaaaaa Something is touching me \naaahhhHGGGGAAAAA!!!",
-                  "* 誰啊啊啊啊啊啊aaa有東西碰我AAAA啊啊啊啊aaa！！"),
-                30, 0.3f);
-        if (canProceed)
-        {
-            currentDialogueState = D_INTRO_2;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    case D_INTRO_2:
-        if (isStateFirstFrame)
-            StartDialogue("* ...", 40, 0.3f);
-        if (canProceed)
-        {
-            currentDialogueState = D_INTRO_4;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    case D_INTRO_4:
-        if (isStateFirstFrame)
-            StartDialogue(
-                L("* Sorry, I've been here alone for so\nlong.",
-                  "* 抱歉，我還以為鬧鬼了。"),
-                printSpeed, 0.3f);
-        if (canProceed)
-        {
-            currentDialogueState = D_INTRO_5;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    case D_INTRO_5:
-        if (isStateFirstFrame)
-            StartDialogue(
-                L("* I'm actually a nonchalant robot.",
-                  "* 我平時其實還挺冷酷的。"),
-                printSpeed, 0.3f);
-        if (canProceed)
-        {
-            currentDialogueState = D_INTRO_6;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    case D_INTRO_6:
-        if (isStateFirstFrame)
-            StartDialogue(
-                L("* Are you a human?",
-                  "* 你是人類嗎？"),
-                printSpeed, 0.5f);
-        if (canProceed)
-        {
-            currentDialogueState = D_HUMAN_CHOICE;
-            menuSelection = 0;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    // ---------------- HUMAN? YES / NO ----------------
-    case D_HUMAN_CHOICE:
+    // --- NODE START ---
+    // Lines and item prompts start the typewriter (drawn from the next frame);
+    // choices keep the previous line on screen
+    int *var = GetDialogueVar(node->var);
+    if (isStateFirstFrame)
     {
-        if (isStateFirstFrame)
-        {
-            isStateFirstFrame = false;
-            dialogTimer = 0.3f;
-        }
-
-        float choiceFontSize = (currentLanguage == LANG_CN) ? 35.0f : 30.0f;
-        float choiceY = (currentLanguage == LANG_CN) ? (box.y + 95.0f) : (box.y + 100.0f);
-
-        DrawTextEx(GetCurrentFont(), L("YES", "是的"),
-                   {(float)(box.x + 200), choiceY},
-                   choiceFontSize, 2, WHITE);
-        DrawTextEx(GetCurrentFont(), L("NO", "不是"),
-                   {(float)(box.x + 450), choiceY},
-                   choiceFontSize, 2, WHITE);
-
-        if (dialogTimer <= 0)
-        {
-            if (IsRightPressed())
-            {
-                PlaySound(sndSelect);
-                menuSelection = 1;
-            }
-            if (IsLeftPressed())
-            {
-                PlaySound(sndSelect);
-                menuSelection = 0;
-            }
-        }
+        isStateFirstFrame = false;
+        dialogTimer = node->waitMs / 1000.0f;
+        menuSelection = 0;
 
-        if (menuSelection == 0)
-            DrawTextureEx(texPlayer, {(float)(box.x + 150), (float)(box.y + 97)}, 0.0f, 0.5f, WHITE);
-        else
-            DrawTextureEx(texPlayer, {(float)(box.x + 400), (float)(box.y + 97)}, 0.0f, 0.5f, WHITE);
-
-        if (canProceed)
+        if (node->type == DNODE_LINE || node->type == DNODE_ITEMS)
         {
-            playerChoiceYesNo = menuSelection;
-            currentDialogueState = D_HUMAN_RESULT_1;
-            isStateFirstFrame = true;
+            int value = (node->type == DNODE_LINE && var != nullptr) ? *var : 0;
+            int speed = (node->speed >= 0) ? node->speed : printSpeed;
+            // Broken to the box once, so the typewriter reveals the final lines
+            const char *line = GetDialogueLine(node, value, column);
+            globalTypewriter.Start(GetWrappedText(GetCurrentFont(), line, dialogueFontSize, 2.0f, box.width - 50), speed);
         }
+        RunDialogueAction(node, DWHEN_ENTER);
     }
-    break;
 
-    case D_HUMAN_RESULT_1:
-        if (isStateFirstFrame)
-        {
-            if (playerChoiceYesNo == 0)
-                StartDialogue(
-                    L("* First human friend!",
-                      "* 第一個人類朋友！"),
-                    printSpeed, 0.3f);
-            else
-                StartDialogue(
-                    L("* Then you are the 1,025th rock I've\nmet today.",
-                      "* 那你就是我今天聊過的第1025塊石頭了。"),
-                    printSpeed, 0.3f);
-        }
-        if (canProceed)
-        {
-            currentDialogueState = D_HUMAN_RESULT_2;
-            isStateFirstFrame = true;
-        }
-        break;
+    float optionFontSize = (currentLanguage == LANG_CN) ? 35.0f : 30.0f;
+    float optionY = (currentLanguage == LANG_CN) ? (box.y + 95.0f) : (box.y + 100.0f);
 
-    case D_HUMAN_RESULT_2:
-        if (isStateFirstFrame)
-        {
-            if (playerChoiceYesNo == 0)
-            {
-                StartDialogue(
-                    L("* I mean. Cool. Whatever.",
-                      "* 額，我的意思是怎麼樣都行啦，我不在乎，嗯，對。"),
-                    printSpeed, 0.3f);
-            }
-            else
-            {
-                StartDialogue(
-                    L("* The other rocks were less talkative.",
-                      "* 其他的石頭沒你這麼健談。"),
-                    printSpeed, 0.3f);
-            }
-            storyProgress = 1;
-        }
-        if (canProceed)
-        {
-            currentDialogueState = D_REQUEST_FOOD_PART1;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    // ---------------- NEED FOOD ----------------
-    case D_REQUEST_FOOD_PART1:
-        if (isStateFirstFrame)
-            StartDialogue(
-                L("* My battery is low.",
-                  "* 我快沒電了。"),
-                printSpeed, 0.3f);
-        if (canProceed)
-        {
-            currentDialogueState = D_REQUEST_FOOD;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    case D_REQUEST_FOOD:
+    switch (node->type)
     {
-        if (isStateFirstFrame)
-        {
-            std::string txt;
-            if (currentLanguage == LANG_CN)
-            {
-                if (storyProgress == 1)
-                    txt = "* 你有吃的嗎？";
-                else if (storyProgress == 2)
-                    txt = "* 我能再要一點點嗎？";
-                else if (storyProgress == 3)
-                    txt = "* 再給最後一口？";
-            }
-            else
-            {
-                if (storyProgress == 1)
-                    txt = "* Do you have any food?";
-                else if (storyProgress == 2)
-                    txt = "* Can I have one more?";
-                else if (storyProgress == 3)
-                    txt = "* Just one last byte?";
-            }
-
-            globalTypewriter.Start(txt.c_str(), printSpeed);
-            isStateFirstFrame = false;
-            dialogTimer = 0.3f;
-        }
-
+    case DNODE_LINE:
         if (canProceed)
-        {
-            currentDialogueState = D_REQUEST_FOOD_CHOICE;
-            menuSelection = 0;
-            isStateFirstFrame = true;
-        }
-    }
-    break;
+            FollowDialogue(node, node->next);
+        break;
 
-    case D_REQUEST_FOOD_CHOICE:
+    // ---------------- CHOICE (YES / NO, GIVE / REFUSE) ----------------
+    case DNODE_CHOICE:
     {
-        if (isStateFirstFrame)
+        for (int i = 0; i < node->optionCount; i++)
         {
-            isStateFirstFrame = false;
-            dialogTimer = 0.3f;
+            const DialogueOption *option = GetDialogueOption(node, i);
+            GfxDrawTextEx(GetCurrentFont(), GetDialogueString(option->text, column),
+                          {(float)(box.x + option->x), optionY},
+                          optionFontSize, 2, WHITE);
         }
 
-        float choiceFontSize = (currentLanguage == LANG_CN) ? 35.0f : 30.0f;
-        float choiceY = (currentLanguage == LANG_CN) ? (box.y + 95.0f) : (box.y + 100.0f);
-
-        DrawTextEx(GetCurrentFont(), L("GIVE", "給予"),
-                   {(float)(box.x + 200), choiceY},
-                   choiceFontSize, 2, WHITE);
-        DrawTextEx(GetCurrentFont(), L("REFUSE", "拒絕"),
-                   {(float)(box.x + 430), choiceY},
-                   choiceFontSize, 2, WHITE);
-
         if (dialogTimer <= 0)
         {
             if (IsRightPressed())
             {
                 PlaySound(sndSelect);
-                menuSelection = 1;
+                if (menuSelection < node->optionCount - 1)
+                    menuSelection++;
             }
             if (IsLeftPressed())
             {
                 PlaySound(sndSelect);
-                menuSelection = 0;
+                if (menuSelection > 0)
+                    menuSelection--;
             }
         }
 
-        if (menuSelection == 0)
-            DrawTextureEx(texPlayer, {(float)(box.x + 150), (float)(box.y + 97)}, 0.0f, 0.5f, WHITE);
-        else
-            DrawTextureEx(texPlayer, {(float)(box.x + 380), (float)(box.y + 97)}, 0.0f, 0.5f, WHITE);
+        // Heart 50px left of the selected label
+        const DialogueOption *selected = GetDialogueOption(node, menuSelection);
+        GfxDrawTextureEx(texPlayer, {(float)(box.x + selected->x - 50), (float)(box.y + 97)}, 0.0f, 0.5f, WHITE);
 
-        if (IsInteractPressed() && dialogTimer <= 0)
+        if (canProceed)
         {
-            if (menuSelection == 0)
-                currentDialogueState = D_SELECT_ITEM;
-            else
-                currentDialogueState = D_REFUSAL;
-            isStateFirstFrame = true;
+            if (var != nullptr)
+                *var = menuSelection;
+            FollowDialogue(node, selected->next);
         }
     }
     break;
 
     // ---------------- SELECT ITEM ----------------
-    case D_SELECT_ITEM:
+    case DNODE_ITEMS:
     {
-        if (isStateFirstFrame)
+        // Options for the items still in the inventory.
+        // Fixed-size list: this runs every frame and must not allocate
+        bool *owned[3] = {&playerInventory.hasCoffee, &playerInventory.hasGas, &playerInventory.hasBattery};
+        int opts[8];
+        int optCount = 0;
+        for (int i = 0; i < node->optionCount && optCount < 8; i++)
         {
-            globalTypewriter.Start(
-                L("Give what?", "給什麼？"),
-                0);
-            isStateFirstFrame = false;
-            dialogTimer = 0.3f;
-            menuSelection = 0;
+            int item = GetDialogueOption(node, i)->item;
+            if (item < 3 && *owned[item])
+                opts[optCount++] = i;
         }
 
-        std::vector<int> opts;
-        if (playerInventory.hasCoffee)
-            opts.push_back(0);
-        if (playerInventory.hasGas)
-            opts.push_back(1);
-        if (playerInventory.hasBattery)
-            opts.push_back(2);
-
         int itemstartX_var = (currentLanguage == LANG_CN) ? 175 : 100;
         int startX = (int)box.x + itemstartX_var;
         int gap = 120;
-        float itemFontSize = (currentLanguage == LANG_CN) ? 35.0f : 30.0f;
-        float itemY = (currentLanguage == LANG_CN) ? (box.y + 95.0f) : (box.y + 100.0f);
 
-        for (size_t i = 0; i < opts.size(); i++)
+        for (int i = 0; i < optCount; i++)
         {
-            const char *label = "";
-            if (opts[i] == 0)
-                label = L("Coffee", "咖啡");
-            if (opts[i] == 1)
-                label = L("Gas", "汽油");
-            if (opts[i] == 2)
-                label = L("Battery", "電池");
-
-            Vector2 textSize = MeasureTextEx(GetCurrentFont(), label, itemFontSize, 2);
-            DrawTextEx(GetCurrentFont(), label, {(float)startX, itemY},
-                       itemFontSize, 2, WHITE);
-
-            if (menuSelection == (int)i)
+            const char *label = GetDialogueString(GetDialogueOption(node, opts[i])->text, column);
+
+            Vector2 textSize = MeasureGameText(GetCurrentFont(), label, optionFontSize, 2);
+            GfxDrawTextEx(GetCurrentFont(), label, {(float)startX, optionY},
+                          optionFontSize, 2, WHITE);
+
+            if (menuSelection == i)
             {
-                DrawTextureEx(texPlayer, {(float)(startX - 50), (float)(box.y + 97)}, 0.0f, 0.5f, WHITE);
+                GfxDrawTextureEx(texPlayer, {(float)(startX - 50), (float)(box.y + 97)}, 0.0f, 0.5f, WHITE);
             }
             startX += (int)textSize.x + gap;
         }
 
-        if (dialogTimer <= 0 && !opts.empty())
+        if (dialogTimer <= 0 && optCount > 0)
         {
-            if (IsRightPressed() && menuSelection < (int)opts.size() - 1)
+            if (IsRightPressed() && menuSelection < optCount - 1)
             {
                 PlaySound(sndSelect);
                 menuSelection++;
@@ -992,109 +825,16 @@ void HandleDialogue()
             }
             if (IsInteractPressed())
             {
-                int chosen = opts[menuSelection];
-                if (chosen == 0)
-                {
-                    playerInventory.hasCoffee = false;
-                    currentDialogueState = D_COFFEE_EVENT;
-                    coffeeScriptStep = 0;
-                    coffeeTimer = 0.0f;
-                    coffeeLog.clear();
-                    bgColor = BLACK;
-                    globalTypewriter.active = false;
-                }
-                else
-                {
-                    if (chosen == 1)
-                    {
-                        playerInventory.hasGas = false;
-                        itemUsedIndex = 1;
-                    }
-                    if (chosen == 2)
-                    {
-                        playerInventory.hasBattery = false;
-                        itemUsedIndex = 2;
-                    }
-                    currentDialogueState = D_EATING;
-                }
-                isStateFirstFrame = true;
+                const DialogueOption *option = GetDialogueOption(node, opts[menuSelection]);
+                *owned[option->item] = false;
+                if (var != nullptr)
+                    *var = option->item;
+                FollowDialogue(node, option->next);
             }
         }
     }
     break;
 
-    // ---------------- EATING ----------------
-    case D_EATING:
-        if (isStateFirstFrame)
-        {
-            if (itemUsedIndex == 1)
-            {
-                StartDialogue(
-                    L("* GLUG GLUG...\n* Premium Octane!",
-                      "* 【咕嘟咕嘟】耶！97號汽油！"),
-                    printSpeed, 0.3f);
-            }
-            else
-            {
-                StartDialogue(
-                    L("* CRUNCH CRUNCH.\n* That flavor!",
-                      "* 【咔呲咔呲】好吃好吃！"),
-                    printSpeed, 0.3f);
-            }
-        }
-        if (canProceed)
-        {
-            storyProgress++;
-            if (storyProgress > 3)
-                storyProgress = 3;
-            currentDialogueState = D_REQUEST_FOOD;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    // ---------------- REFUSAL ----------------
-    case D_REFUSAL:
-        if (isStateFirstFrame)
-            StartDialogue(
-                L("* Oh... okay.\n* I'll just go into Sleep Mode\nFOREVER.",
-                  "* 噢好吧 ... \n* 那我就要進入一輩子的休眠模式了。"),
-                printSpeed, 0.3f);
-        if (canProceed)
-        {
-            currentState = MAP_WALK;
-            interactionCooldown = 0.2f;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    // ---------------- POST BATTLE ----------------
-    case D_POST_BATTLE:
-        if (isStateFirstFrame)
-            StartDialogue(
-                L("* I am sorry about what just happened.",
-                  "* 我為剛才發生過的事情感到抱歉。"),
-                printSpeed, 0.3f);
-        if (canProceed)
-        {
-            currentDialogueState = D_POST_BATTLE_2;
-            isStateFirstFrame = true;
-        }
-        break;
-
-    case D_POST_BATTLE_2:
-        if (isStateFirstFrame)
-            StartDialogue(
-                L("* And by the way you just finished\nthe game.",
-                  "* 順便說一句，你已經把這個遊戲打完了。"),
-                printSpeed, 0.3f);
-        if (canProceed)
-        {
-            currentState = MAP_WALK;
-            interactionCooldown = 0.2f;
-            isStateFirstFrame = true;
-        }
-        break;
-
     default:
         break;
     }
@@ -1102,178 +842,331 @@ void HandleDialogue()
 
 void HandleGameOver()
 {
-    UpdateMusicStream(gameOver);
     Font activeFont = GetCurrentFont();
-    // Choose text based on language
-    const char *gameoverStr = Text("GAME OVER", "遊戲結束");
-    if (currentLanguage == LANG_EN)
-    {
-        TextMetrics gameoverM = GetCenteredTextPosition(activeFont, gameoverStr, 80, 2);
-        DrawTextEx(activeFont, gameoverStr, {gameoverM.x, 150}, 80, 2, RED);
-    }
-    else
-    {
-        TextMetrics gameoverM = GetCenteredTextPosition(activeFont, gameoverStr, 101, 2);
-        DrawTextEx(activeFont, gameoverStr, {gameoverM.x, 150}, 101, 2, RED);
-    }
-    const char *deterStr = Text("Whoever you are... stay determined!", "不管你是誰...都不要放棄!");
     if (currentLanguage == LANG_EN)
     {
-        TextMetrics gameoverM = GetCenteredTextPosition(activeFont, deterStr, 25, 2);
-        DrawTextEx(activeFont, deterStr, {gameoverM.x, 350}, 25, 2, WHITE);
+        DrawCenteredText(activeFont, STR_GAMEOVER_TITLE, 150, 80, 2, RED);
+        DrawCenteredText(activeFont, STR_GAMEOVER_DETERMINED, 350, 25, 2, WHITE);
+        DrawCenteredText(activeFont, STR_GAMEOVER_RETRY, 450, 30, 2, GRAY);
     }
     else
     {
-        TextMetrics gameoverM = GetCenteredTextPosition(activeFont, deterStr, 32, 2);
-        DrawTextEx(activeFont, deterStr, {gameoverM.x, 375}, 32, 2, WHITE);
-    }
-    const char *retryStr = Text("Press Z to Retry", "按Z重試");
-    if (currentLanguage == LANG_EN)
-    {
-        TextMetrics gameoverM = GetCenteredTextPosition(activeFont, retryStr, 30, 2);
-        DrawTextEx(activeFont, retryStr, {gameoverM.x, 450}, 30, 2, GRAY);
-    }
-    else
-    {
-        TextMetrics gameoverM = GetCenteredTextPosition(activeFont, retryStr, 38, 2);
-        DrawTextEx(activeFont, retryStr, {gameoverM.x, 450}, 38, 2, GRAY);
+        DrawCenteredText(activeFont, STR_GAMEOVER_TITLE, 150, 101, 2, RED);
+        DrawCenteredText(activeFont, STR_GAMEOVER_DETERMINED, 375, 32, 2, WHITE);
+        DrawCenteredText(activeFont, STR_GAMEOVER_RETRY, 450, 38, 2, GRAY);
     }
 
     if (IsInteractPressed())
     {
-        StopMusicStream(gameOver); // Stop gameOver music
+        StopMusic(MUSIC_GAME_OVER); // Stop gameOver music
         currentState = BATTLE;
         InitBattle();
     }
 }
 
-int main()
+// Shared by the windowed and headless loops, after assets are loaded
+void InitGame()
 {
-    InitWindow(GAME_WIDTH, GAME_HEIGHT, "Undertail");
-    InitAudioDevice();
-    SetTargetFPS(60);
+    if (!LoadDialogueScript("dialogue.bin"))
+        TraceLog(LOG_ERROR, "dialogue.bin missing, the robot has nothing to say");
+    if (!LoadStringCatalog("strings.bin"))
+        TraceLog(LOG_ERROR, "strings.bin missing, menus and battle have no text");
+    if (!LoadCollisionMap("collision.bin", &walkableFloors, &walkableMask))
+        TraceLog(LOG_ERROR, "collision.bin missing, the floor has no edges");
 
-    ChangeDirectory(GetApplicationDirectory());
-    LoadGameAssets();
+    globalTypewriter.Subscribe(PlayTextBlip);
 
-    fontEN = LoadFontEx("assets/determination-mono.otf", 64, 0, 0);
+    // After InitWindow, which seeds from the clock
+    SetRandomSeed(simConfig.seed);
 
-    // ================== CHINESE FONT LOADING ==================
-    char *textToLoad = LoadFileText("assets/dialogues_CN.txt");
-    int codepointCount = 0;
-    int *codepoints = NULL;
+    player.Init(125, 300);
+    player.SetZones(walkableFloors, walkableMask);
 
-    if (textToLoad != nullptr)
+    if (DEBUG_SKIP_TO_BATTLE)
     {
-        std::string allText = std::string(textToLoad);
-        codepoints = LoadCodepoints(allText.c_str(), &codepointCount);
-        UnloadFileText(textToLoad);
+        currentState = BATTLE;
+        preBattleX = player.pos.x;
+        preBattleY = player.pos.y;
+        InitBattle();
     }
-    else
-    {
-        TraceLog(LOG_WARNING, "dialogues_CN.txt not found! Loading UI chars only.");
+}
 
-        // If the file is missing
-        std::string fallbackText = "傳說之上下左右按切換中文是的不是給予拒絕咖啡汽油電池";
-        codepoints = LoadCodepoints(fallbackText.c_str(), &codepointCount);
-        // --- FIX END ---
+// Runs one tick of whichever state is active
+void UpdateGameState()
+{
+    switch (currentState)
+    {
+    case MENU:
+        HandleMenu();
+        break;
+    case MAP_WALK:
+        HandleMap();
+        break;
+    case DIALOGUE:
+        HandleDialogue();
+        break;
+    case BATTLE:
+        UpdateBattle();
+        DrawBattle();
+        break;
+    case GAME_OVER:
+        HandleGameOver();
+        break;
     }
+}
 
-    // 2. Load Font Data (WITH SAFETY CHECK)
-    int fileSize = 0;
-    unsigned char *fontFileData = LoadFileData("assets/fusion-pixel-12px-proportional-zh_hant.ttf", &fileSize);
+// No window, no audio device, no assets: the autopilot plays the whole game
+// with a fixed dt and we report how many ticks per second the CPU managed.
+int RunHeadless()
+{
+    InitGame();
 
-    if (fontFileData != NULL && codepointCount > 0)
-    {
-        fontCN = {0};
-        fontCN.baseSize = 64;
+    // Safety net so a stuck autopilot can't spin forever (one simulated hour)
+    long tickLimit = simConfig.maxTicks;
+    if (tickLimit <= 0)
+        tickLimit = (long)(3600.0f / simConfig.fixedDt);
+
+    // Heap allocations per tick, bucketed by the state the tick ran in
+    long long allocsByState[GAME_STATE_COUNT] = {};
+    long ticksByState[GAME_STATE_COUNT] = {};
+
+    // The tick to bisect a spike to
+    double slowestTickUs = 0.0;
+    long slowestTick = 0;
+    GameState slowestState = MENU;
 
-        int glyphsLoadedCount = 0;
-        GlyphInfo *glyphs = LoadFontData(fontFileData, fileSize, fontCN.baseSize,
-                                         codepoints, codepointCount,
-                                         FONT_DEFAULT);
+    auto start = std::chrono::steady_clock::now();
 
-        if (glyphs != NULL)
+    while (simTick < tickLimit)
+    {
+        if (IsReplaying())
         {
-            glyphsLoadedCount = codepointCount;
+            if (IsReplayFinished())
+                break;
+            BeginInputTick();
         }
-        // Now this check will pass because glyphsLoadedCount is no longer 0
-        if (glyphs == NULL || glyphsLoadedCount == 0)
+        else
         {
-            TraceLog(LOG_ERROR, "Failed to load Chinese glyphs, using default font");
-            fontCN = GetFontDefault();
+            UpdateAutoPilot();
         }
-        else
+        UpdateInputReplay();
+
+        GameState tickState = currentState;
+        long long allocsBefore = GetAllocationCount();
+        auto tickStart = std::chrono::steady_clock::now();
+
         {
-            fontCN.glyphs = glyphs;
-            fontCN.glyphCount = glyphsLoadedCount;
-
-            // Generate the texture atlas (the actual image of the letters)
-            Image atlas = GenImageFontAtlas(fontCN.glyphs, &fontCN.recs,
-                                            glyphsLoadedCount, fontCN.baseSize, 4, 0);
-            fontCN.texture = LoadTextureFromImage(atlas);
-            UnloadImage(atlas);
+            PROFILE_ZONE("Tick");
+            BeginRenderFrame();
+            UpdateGameState();
+            EndRenderFrame();
         }
 
-        UnloadFileData(fontFileData); // free the raw file data
+        double tickUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - tickStart).count();
+        if (tickUs > slowestTickUs)
+        {
+            slowestTickUs = tickUs;
+            slowestTick = simTick;
+            slowestState = tickState;
+        }
+
+        allocsByState[tickState] += GetAllocationCount() - allocsBefore;
+        ticksByState[tickState]++;
+        simTick++;
+
+        if (simConfig.maxTicks <= 0 && !IsReplaying() && IsPlaythroughComplete())
+            break;
     }
-    else
+
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double ticksPerSecond = (seconds > 0.0) ? simTick / seconds : 0.0;
+
+    printf("Headless run: %ld ticks (%.1f s simulated) in %.3f ms, %.0f ticks/s%s\n",
+           simTick, simTick * simConfig.fixedDt, seconds * 1000.0, ticksPerSecond,
+           IsReplaying() ? ", replay" : IsPlaythroughComplete() ? ", playthrough complete" : "");
+    StopInputRecording();
+    StopProfiler();
+    ShutdownRenderer();
+
+    static const char *stateNames[GAME_STATE_COUNT] = {"MENU", "MAP_WALK", "DIALOGUE", "BATTLE", "GAME_OVER"};
+    printf("Slowest tick: %ld (%.1f us, %s)\n", slowestTick, slowestTickUs, stateNames[slowestState]);
+    printf("%-10s %12s\n", "State", "Allocs/tick");
+    for (int i = 0; i < GAME_STATE_COUNT; i++)
     {
-        TraceLog(LOG_ERROR, "Chinese font file missing, using default font");
-        fontCN = GetFontDefault();
+        if (ticksByState[i] > 0)
+            printf("%-10s %12.3f\n", stateNames[i], (double)allocsByState[i] / ticksByState[i]);
     }
 
-    if (codepoints != NULL)
-        UnloadCodepoints(codepoints);
-    // =================================================================
+    return (simConfig.maxTicks > 0 || IsReplaying() || IsPlaythroughComplete()) ? 0 : 1;
+}
+
+// Most ticks one frame may run to catch up with real time
+#define MAX_CATCHUP_TICKS 5
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    auto launchTime = std::chrono::steady_clock::now();
+
+    ParseSimArgs(argc, argv);
+    if (simConfig.tracePath != nullptr)
+        StartProfiler(simConfig.tracePath);
+    if (simConfig.replayPath != nullptr && !StartInputReplay(simConfig.replayPath))
+        return 1;
+    if (simConfig.inputRecordPath != nullptr && !StartInputRecording(simConfig.inputRecordPath))
+        return 1;
+    InitRenderer(simConfig.headless, simConfig.recordPath);
+    if (simConfig.headless)
+        return RunHeadless();
+
+    InitWindow(GAME_WIDTH, GAME_HEIGHT, "Undertail");
+    InitAudioDevice();
+
+    ChangeDirectory(GetApplicationDirectory());
+
+    // Decoding runs on worker threads; PumpAssetLoader() uploads as it goes
+    LoadGameFonts();
+    LoadGameAssets();
+    StartAssetLoader();
+    StartMusicThread();
 
     RenderTexture2D target = LoadRenderTexture(GAME_WIDTH, GAME_HEIGHT);
     SetTextureFilter(target.texture, TEXTURE_FILTER_POINT);
+    raylibRenderer.frameTarget = target;
 
-    player.Init(125, 300);
-    player.SetZones(walkableFloors);
+    InitGame();
 
-    if (DEBUG_SKIP_TO_BATTLE)
-    {
-        currentState = BATTLE;
-        preBattleX = player.pos.x;
-        preBattleY = player.pos.y;
-        InitBattle();
-    }
+    bool firstFrameShown = false;
+    bool interactive = false;
+    float tickTime = 0.0f; // Real time not yet simulated
+    double lastFrameStart = GetTime();
 
     while (!WindowShouldClose())
     {
-        BeginTextureMode(target);
-        ClearBackground(BLACK);
-        switch (currentState)
+        // Timed here rather than with GetFrameTime(): idle frames skip
+        // EndDrawing(), which is what updates it
+        double frameStart = GetTime();
+        float frameTime = (float)(frameStart - lastFrameStart);
+        lastFrameStart = frameStart;
+
+        long long allocsBefore = GetAllocationCount();
+        PumpAssetLoader();
+        PollInput();
+        UpdatePerfHud();
+
+        // The trace so far, without closing the game
+        if (IsKeyPressed(KEY_F4))
+            WriteProfileTrace();
+
+        // Fonts and textures show up while the loader runs
+        if (!IsAssetLoaderDone() || IsWindowResized())
+            MarkFrameDirty();
+
+        // A long hitch (asset upload, a debugger pause) is dropped rather
+        // than simulated all at once
+        tickTime += fminf(frameTime, MAX_CATCHUP_TICKS * simConfig.fixedDt);
+        int ticks = (int)(tickTime / simConfig.fixedDt);
+        tickTime -= ticks * simConfig.fixedDt;
+        renderAlpha = tickTime / simConfig.fixedDt;
+
+        // Every tick runs, but only one that follows a change draws; the
+        // last one drawn is shown
+        bool drawn = false;
+        PerfFrame perf = {};
+        perf.ticks = ticks;
+        for (int i = 0; i < ticks; i++)
         {
-        case MENU:
-            HandleMenu();
-            break;
-        case MAP_WALK:
-            HandleMap();
-            break;
-        case DIALOGUE:
-            HandleDialogue();
-            break;
-        case BATTLE:
-            UpdateBattle();
-            DrawBattle();
-            break;
-        case GAME_OVER:
-            HandleGameOver();
-            break;
+            BeginInputTick();
+            if (IsAssetLoaderDone())
+                UpdateInputReplay();
+
+            bool draw = TakeFrameDirty();
+            GameState stateBefore = currentState;
+            int nodeBefore = currentDialogueNode;
+
+            BeginTextureMode(target);
+            if (draw)
+                ClearBackground(BLACK);
+            SetFrameDrawsSkipped(!draw);
+            double updateStart = GetTime();
+            {
+                PROFILE_ZONE("Tick");
+                BeginRenderFrame();
+                UpdateGameState();
+                EndRenderFrame();
+            }
+            double updateEnd = GetTime();
+            SetFrameDrawsSkipped(false);
+            EndTextureMode();
+            perf.updateMs += (float)((updateEnd - updateStart) * 1000.0);
+            perf.drawMs += (float)((GetTime() - updateEnd) * 1000.0);
+            perf.drawnTicks += draw ? 1 : 0;
+            simTick++;
+
+            if (currentState != stateBefore || currentDialogueNode != nodeBefore)
+                MarkFrameDirty();
+            drawn = drawn || draw;
+        }
+
+        // The HUD's graph moves every frame, so it keeps the window presenting
+        bool present = drawn || IsPerfHudVisible();
+        if (present)
+        {
+            PROFILE_ZONE("Present");
+            double presentStart = GetTime();
+            BeginDrawing();
+            ClearBackground(BLACK);
+            DrawTexturePro(target.texture, {0.0f, 0.0f, (float)target.texture.width, -(float)target.texture.height}, {0.0f, 0.0f, (float)GetScreenWidth(), (float)GetScreenHeight()}, {0.0f, 0.0f}, 0.0f, WHITE);
+            DrawPerfHud();
+            EndDrawing();
+            perf.drawMs += (float)((GetTime() - presentStart) * 1000.0);
+        }
+        else
+        {
+            // Nothing new on screen: no GPU work
+            PollInputEvents();
+        }
+
+        // Paced here rather than with SetTargetFPS(), which would hide the
+        // wait inside EndDrawing() and the HUD's draw time. Ticks draw as
+        // they update, so showing frames faster than the tick rate would
+        // only repeat the last one.
+        double idle = simConfig.fixedDt - (GetTime() - frameStart);
+        if (idle > 0.0)
+            WaitTime(idle);
+
+        perf.frameMs = (float)((GetTime() - frameStart) * 1000.0);
+        perf.allocations = GetAllocationCount() - allocsBefore;
+        RecordPerfFrame(perf);
+
+        if (!firstFrameShown && drawn)
+        {
+            firstFrameShown = true;
+            TraceLog(LOG_INFO, "BOOT: time to first frame %.1f ms", MillisecondsSince(launchTime));
+        }
+        if (!interactive && IsAssetLoaderDone())
+        {
+            interactive = true;
+            MarkFrameDirty(); // The loading bar gives way to the prompt
+            TraceLog(LOG_INFO, "BOOT: time to interactive %.1f ms", MillisecondsSince(launchTime));
         }
-        EndTextureMode();
-        BeginDrawing();
-        ClearBackground(BLACK);
-        DrawTexturePro(target.texture, {0.0f, 0.0f, (float)target.texture.width, -(float)target.texture.height}, {0.0f, 0.0f, (float)GetScreenWidth(), (float)GetScreenHeight()}, {0.0f, 0.0f}, 0.0f, WHITE);
-        EndDrawing();
     }
 
-    UnloadFont(fontEN);
-    UnloadFont(fontCN);
+    // Closed mid-load: let the workers finish so everything can be unloaded
+    FinishAssetLoader();
+
+    StopInputRecording();
+    StopProfiler();
+    ShutdownRenderer();
+    coffeeLog.Unload();
+    UnloadGameFonts();
     UnloadRenderTexture(target);
+    StopMusicThread();
     UnloadGameAssets();
     CloseAudioDevice();
     CloseWindow();
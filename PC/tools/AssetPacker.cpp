@@ -0,0 +1,98 @@
+// Build step: packs the game assets into one file for memory-mapping.
+//
+//   AssetPacker <out.pack> <input files...>
+//
+// Each file is stored under its file name (folder stripped).
+
+#include "../src/AssetPack.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static const char *BaseName(const char *path)
+{
+    const char *name = path;
+    for (const char *p = path; *p; p++)
+    {
+        if (*p == '/' || *p == '\\')
+            name = p + 1;
+    }
+    return name;
+}
+
+static bool ReadWholeFile(const char *path, std::vector<unsigned char> *out)
+{
+    FILE *f = fopen(path, "rb");
+    if (f == nullptr)
+        return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    out->resize(size > 0 ? size : 0);
+    size_t read = size > 0 ? fread(out->data(), 1, size, f) : 0;
+    fclose(f);
+    return read == out->size();
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        printf("Usage: AssetPacker <out.pack> <input files...>\n");
+        return 1;
+    }
+
+    int fileCount = argc - 2;
+    std::vector<PackEntry> entries(fileCount);
+    std::vector<std::vector<unsigned char>> contents(fileCount);
+
+    // Data starts after the index, every file 16-byte aligned
+    uint64_t offset = sizeof(PackHeader) + fileCount * sizeof(PackEntry);
+    for (int i = 0; i < fileCount; i++)
+    {
+        const char *path = argv[i + 2];
+        const char *name = BaseName(path);
+        if (strlen(name) >= ASSET_PACK_NAME_LEN)
+        {
+            printf("AssetPacker: name too long: %s\n", name);
+            return 1;
+        }
+        if (!ReadWholeFile(path, &contents[i]))
+        {
+            printf("AssetPacker: cannot read %s\n", path);
+            return 1;
+        }
+
+        offset = (offset + 15) & ~(uint64_t)15;
+        memset(&entries[i], 0, sizeof(PackEntry));
+        strcpy(entries[i].name, name);
+        entries[i].offset = offset;
+        entries[i].size = contents[i].size();
+        offset += contents[i].size();
+    }
+
+    FILE *out = fopen(argv[1], "wb");
+    if (out == nullptr)
+    {
+        printf("AssetPacker: cannot write %s\n", argv[1]);
+        return 1;
+    }
+
+    PackHeader header = {ASSET_PACK_MAGIC, ASSET_PACK_VERSION, (uint32_t)fileCount, 0};
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(entries.data(), sizeof(PackEntry), fileCount, out);
+
+    static const unsigned char zeros[16] = {0};
+    uint64_t written = sizeof(PackHeader) + fileCount * sizeof(PackEntry);
+    for (int i = 0; i < fileCount; i++)
+    {
+        fwrite(zeros, 1, entries[i].offset - written, out);
+        if (!contents[i].empty())
+            fwrite(contents[i].data(), 1, contents[i].size(), out);
+        written = entries[i].offset + entries[i].size;
+    }
+    fclose(out);
+
+    printf("AssetPacker: %d files, %llu bytes -> %s\n", fileCount, (unsigned long long)written, argv[1]);
+    return 0;
+}
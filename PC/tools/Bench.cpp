@@ -0,0 +1,326 @@
+// Microbenchmarks: the per-tick helpers timed in isolation.
+//
+//   bench [--json <out.json>] [--min-ms <n>] [--filter <substring>]
+//
+// Runs without a window, like a headless game run: draws go to the
+// recording renderer, keys come from the virtual keyboard. Fonts are loaded
+// for their glyph metrics only (no texture upload), from assets/ next to
+// the executable. Each benchmark warms up, then repeats until it has run for
+// at least --min-ms (default 200), and reports ns and heap allocations per
+// call. Results go to stdout as a table and to --json (default bench.json)
+// for tracking over time.
+
+#include "raylib.h"
+#include "../src/game_defs.h"
+#include "../src/Globals.h"
+#include "../src/Utils.h"
+#include "../src/Player.h"
+#include "../src/Render.h"
+#include "../src/Input.h"
+#include "../src/Sim.h"
+#include "../src/Fonts.h"
+#include "../src/TextAlignment.h"
+#include "../src/TextLayout.h"
+#include "../src/AllocCounter.h"
+#include "../src/CollisionMap.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Defined in main.cpp in the game; the code under test refers to them
+int currentDialogueNode = 0;
+std::vector<Rect> walkableFloors;
+CollisionMask walkableMask;
+NPC mapEnemy = {425, 280};
+
+// Defined in Battle.cpp
+void SetupBox(int x, int y, int w, int h);
+
+// Lines the game actually shows
+static const char *LINE_EN = "Its existence is even more\nmeaningless than humans.";
+static const char *LINE_CN = "用咖啡來讓本就超負荷的身體繼續工作？";
+
+struct BenchResult
+{
+    std::string name;
+    long ops;
+    double nsPerOp;
+    double allocsPerOp;
+};
+
+static std::vector<BenchResult> results;
+static double minMs = 200.0;
+static const char *filter = nullptr;
+
+template <typename Op>
+static void RunBench(const char *name, Op op)
+{
+    if (filter != nullptr && strstr(name, filter) == nullptr)
+        return;
+
+    // Warm up: fills the glyph cache, grows vectors to their steady size
+    for (int i = 0; i < 1000; i++)
+        op();
+
+    long ops = 1000;
+    for (;;)
+    {
+        long long allocsBefore = GetAllocationCount();
+        auto start = std::chrono::steady_clock::now();
+        for (long i = 0; i < ops; i++)
+            op();
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        long long allocs = GetAllocationCount() - allocsBefore;
+
+        if (ns >= minMs * 1e6 || ops >= (1L << 30))
+        {
+            results.push_back({name, ops, ns / ops, (double)allocs / ops});
+            const BenchResult &r = results.back();
+            printf("%-32s %12ld %12.1f %10.3f\n", r.name.c_str(), r.ops, r.nsPerOp, r.allocsPerOp);
+            return;
+        }
+
+        // Aim a little past the target so the next round is usually the last
+        double scale = (ns > 0.0) ? minMs * 1e6 * 1.2 / ns : 100.0;
+        ops = (long)(ops * (scale < 100.0 ? (scale > 2.0 ? scale : 2.0) : 100.0));
+    }
+}
+
+// Keeps the recorder's command list from growing without bound; a game
+// frame clears it the same way
+static void NextFrameEvery(int calls)
+{
+    static int count = 0;
+    if (++count >= calls)
+    {
+        count = 0;
+        BeginRenderFrame();
+    }
+}
+
+// The glyph tables LoadGameFonts() builds, without the texture. The glyph
+// cache keys fonts by texture id, so each gets a distinct placeholder one;
+// the recording renderer never binds it.
+static bool LoadFontMetricsEN(Font *out)
+{
+    int size = 0;
+    unsigned char *data = LoadFileData("assets/determination-mono.otf", &size);
+    if (data == nullptr)
+        return false;
+
+    Font font = {0};
+    font.baseSize = 64;
+    font.glyphCount = 95; // ASCII 32..126
+    font.glyphPadding = 4;
+    font.glyphs = LoadFontData(data, size, font.baseSize, NULL, 0, FONT_DEFAULT);
+    UnloadFileData(data);
+    if (font.glyphs == nullptr)
+        return false;
+
+    Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, font.glyphPadding, 0);
+    UnloadImage(atlas);
+    font.texture.id = 1;
+    *out = font;
+    return true;
+}
+
+static bool LoadFontMetricsCN(Font *out)
+{
+    int size = 0;
+    unsigned char *data = LoadFileData("assets/fontCN.atlas", &size);
+    if (data == nullptr)
+        return false;
+
+    Image atlas;
+    bool ok = ParseBakedFont(data, size, out, &atlas);
+    UnloadFileData(data); // The glyph tables are copies
+    if (ok)
+        out->texture.id = 2;
+    return ok;
+}
+
+static void BenchText(const char *lang, Font font, const char *line, float fontSize)
+{
+    char name[64];
+
+    snprintf(name, sizeof(name), "DrawTextJitter/%s", lang);
+    RunBench(name, [&]
+             {
+                 DrawTextJitter(font, line, {40.0f, 400.0f}, fontSize, 2.0f, WHITE);
+                 NextFrameEvery(64); });
+
+    snprintf(name, sizeof(name), "GetCenteredTextPosition/%s", lang);
+    volatile float sink = 0.0f;
+    RunBench(name, [&]
+             { sink = sink + GetCenteredTextPosition(font, line, fontSize, 2.0f).x; });
+
+    // The cached path static screens use instead of the two above
+    snprintf(name, sizeof(name), "DrawCenteredText/%s", lang);
+    RunBench(name, [&]
+             {
+                 DrawCenteredText(font, line, 400.0f, fontSize, 2.0f, WHITE);
+                 NextFrameEvery(64); });
+
+    // What starting a dialogue line costs once the wrap is cached
+    snprintf(name, sizeof(name), "GetWrappedText/%s", lang);
+    volatile const char *wrapped = nullptr;
+    RunBench(name, [&]
+             { wrapped = GetWrappedText(font, line, fontSize, 2.0f, 700.0f); });
+
+    // A line revealing one codepoint every two ticks, started over when done
+    snprintf(name, sizeof(name), "Typewriter::Update/%s", lang);
+    Typewriter typewriter;
+    typewriter.Start(line, 30);
+    RunBench(name, [&]
+             {
+                 typewriter.Update();
+                 if (typewriter.IsFinished())
+                     typewriter.Start(line, 30); });
+
+    typewriter.Start(line, 30);
+    typewriter.Skip();
+
+    snprintf(name, sizeof(name), "Typewriter::Draw/%s", lang);
+    RunBench(name, [&]
+             {
+                 typewriter.Draw(font, 40, 400, fontSize, 2.0f, WHITE);
+                 NextFrameEvery(64); });
+
+    snprintf(name, sizeof(name), "Typewriter::DrawJitter/%s", lang);
+    RunBench(name, [&]
+             {
+                 typewriter.DrawJitter(font, {40.0f, 400.0f}, fontSize, 2.0f, WHITE);
+                 NextFrameEvery(64); });
+}
+
+// Holds one direction for a while, then the opposite, so the player keeps
+// running into walls and back out
+static void WalkKeys(int step)
+{
+    bool flip = (step / 64) % 2 != 0;
+    SetVirtualKey(KEY_RIGHT, !flip);
+    SetVirtualKey(KEY_LEFT, flip);
+    SetVirtualKey(KEY_DOWN, (step / 48) % 2 == 0);
+    SetVirtualKey(KEY_UP, (step / 48) % 2 != 0);
+}
+
+static void BenchPlayer()
+{
+    const float dt = GetGameFrameTime();
+
+    // Map: the baked floor
+    currentState = MAP_WALK;
+    player.Init(400, 400);
+    player.SetZones(walkableFloors, walkableMask);
+
+    unsigned int rng = 2463534242u;
+    volatile int hits = 0;
+    RunBench("Player::CheckCollision", [&]
+             {
+                 rng ^= rng << 13;
+                 rng ^= rng >> 17;
+                 rng ^= rng << 5;
+                 Vector2 p = {(float)(rng % GAME_WIDTH), (float)((rng >> 16) % GAME_HEIGHT)};
+                 hits = hits + (player.CheckCollision(p, PLAYER_W, PLAYER_H) ? 1 : 0); });
+
+    int step = 0;
+    RunBench("Player::Update/map", [&]
+             {
+                 WalkKeys(step++);
+                 player.Update(dt, &mapEnemy); });
+
+    // Battle: boxed in by the question box
+    currentState = BATTLE;
+    SetupBox(9, 41, 141, 72);
+    player.Init(300, 350);
+    step = 0;
+    RunBench("Player::Update/battle", [&]
+             {
+                 WalkKeys(step++);
+                 player.Update(dt); });
+
+    // The box changes every question
+    int box = 0;
+    RunBench("SetupBox", [&]
+             {
+                 if ((box++ & 1) == 0)
+                     SetupBox(9, 41, 141, 72);
+                 else
+                     SetupBox(40, 60, 80, 40); });
+
+    for (int key : {KEY_RIGHT, KEY_LEFT, KEY_DOWN, KEY_UP})
+        SetVirtualKey(key, false);
+}
+
+static bool WriteJson(const char *path)
+{
+    FILE *out = fopen(path, "w");
+    if (out == nullptr)
+    {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return false;
+    }
+
+    fprintf(out, "{\n  \"version\": 1,\n  \"benchmarks\": [");
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const BenchResult &r = results[i];
+        fprintf(out, "%s\n    {\"name\": \"%s\", \"ops\": %ld, \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f}",
+                i ? "," : "", r.name.c_str(), r.ops, r.nsPerOp, r.allocsPerOp);
+    }
+    fprintf(out, "\n  ]\n}\n");
+    fclose(out);
+
+    printf("%d results -> %s\n", (int)results.size(), path);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *jsonPath = "bench.json";
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (strcmp(argv[i], "--min-ms") == 0 && i + 1 < argc)
+            minMs = atof(argv[++i]);
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else
+        {
+            printf("Usage: bench [--json <out.json>] [--min-ms <n>] [--filter <substring>]\n");
+            return 1;
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    ChangeDirectory(GetApplicationDirectory());
+    simConfig.headless = true;
+    InitRenderer(true, nullptr);
+
+    if (!LoadCollisionMap("collision.bin", &walkableFloors, &walkableMask))
+    {
+        fprintf(stderr, "No assets/collision.bin; build the BakeCollision target first\n");
+        return 1;
+    }
+
+    printf("%-32s %12s %12s %10s\n", "Benchmark", "Ops", "ns/op", "Allocs/op");
+
+    Font font;
+    if (LoadFontMetricsEN(&font))
+        BenchText("en", font, LINE_EN, 30.0f);
+    else
+        fprintf(stderr, "No assets/determination-mono.otf, skipping English text\n");
+
+    if (LoadFontMetricsCN(&font))
+        BenchText("cn", font, LINE_CN, 40.0f);
+    else
+        fprintf(stderr, "No assets/fontCN.atlas, skipping Chinese text\n");
+
+    BenchPlayer();
+
+    return WriteJson(jsonPath) ? 0 : 1;
+}
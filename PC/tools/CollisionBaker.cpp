@@ -0,0 +1,216 @@
+// Build step: bakes the walkable floor from the mask painted over the map.
+//
+//   CollisionBaker <mask.png> <out.bin> [--header <out.h>]
+//
+// The mask is the size of background.png; opaque light pixels are floor.
+// Writes the bit grid and a rect cover at PC scale (format in
+// src/CollisionFormat.h). --header also writes the floor at ESP32 scale
+// (one pixel per 5x5 block) as rects plus the bit grid Player::setZones
+// builds, for the sketch.
+
+#include "raylib.h"
+#include "../src/CollisionFormat.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static_assert(sizeof(CollisionMapHeader) == 24, "header layout");
+static_assert(sizeof(CollisionRect) == 8, "rect layout");
+
+// Matches ESP32/Arduino/game_defs.h
+#define ESP32_SCREEN_W 160
+#define ESP32_SCREEN_H 128
+#define ESP32_SCALE 5
+
+struct Grid
+{
+    int width = 0, height = 0;
+    std::vector<unsigned char> cells;
+
+    bool At(int x, int y) const
+    {
+        return x >= 0 && y >= 0 && x < width && y < height && cells[(size_t)y * width + x];
+    }
+};
+
+// Greedy cover: take the first uncovered cell, run it right, then grow the
+// run down while the whole row below is floor and uncovered. Not the minimum
+// cover, but close for floors made of stacked bands.
+static std::vector<CollisionRect> CoverRects(const Grid &grid)
+{
+    std::vector<CollisionRect> rects;
+    std::vector<unsigned char> used(grid.cells.size(), 0);
+    auto free = [&](int x, int y)
+    { return grid.At(x, y) && !used[(size_t)y * grid.width + x]; };
+
+    for (int y = 0; y < grid.height; y++)
+    {
+        for (int x = 0; x < grid.width; x++)
+        {
+            if (!free(x, y))
+                continue;
+
+            int x1 = x;
+            while (free(x1 + 1, y))
+                x1++;
+
+            int y1 = y;
+            for (;;)
+            {
+                bool rowFree = true;
+                for (int i = x; i <= x1 && rowFree; i++)
+                    rowFree = free(i, y1 + 1);
+                if (!rowFree)
+                    break;
+                y1++;
+            }
+
+            for (int j = y; j <= y1; j++)
+                memset(&used[(size_t)j * grid.width + x], 1, x1 - x + 1);
+
+            // Rect edges are inclusive
+            rects.push_back({(int16_t)x, (int16_t)y, (int16_t)(x1 - x), (int16_t)(y1 - y)});
+        }
+    }
+    return rects;
+}
+
+static bool WriteBin(const char *path, const Grid &grid, const std::vector<CollisionRect> &rects)
+{
+    int minX = grid.width, minY = grid.height, maxX = -1, maxY = -1;
+    for (const CollisionRect &r : rects)
+    {
+        if (r.x < minX) minX = r.x;
+        if (r.y < minY) minY = r.y;
+        if (r.x + r.w > maxX) maxX = r.x + r.w;
+        if (r.y + r.h > maxY) maxY = r.y + r.h;
+    }
+    if (rects.empty())
+        minX = minY = 0;
+
+    CollisionMapHeader header = {};
+    header.magic = COLLISION_MAGIC;
+    header.version = COLLISION_VERSION;
+    header.maskX = (int16_t)minX;
+    header.maskY = (int16_t)minY;
+    header.maskWidth = (uint16_t)(maxX - minX + 1);
+    header.maskHeight = (uint16_t)(maxY - minY + 1);
+    header.wordsPerRow = (uint16_t)((header.maskWidth + 63) / 64);
+    header.rectCount = (uint16_t)rects.size();
+
+    std::vector<uint64_t> words((size_t)header.wordsPerRow * header.maskHeight, 0);
+    for (int y = 0; y < header.maskHeight; y++)
+        for (int x = 0; x < header.maskWidth; x++)
+            if (grid.At(minX + x, minY + y))
+                words[(size_t)y * header.wordsPerRow + (x >> 6)] |= 1ULL << (x & 63);
+
+    FILE *out = fopen(path, "wb");
+    if (out == nullptr)
+    {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return false;
+    }
+    fwrite(&header, sizeof(header), 1, out);
+    fwrite(rects.data(), sizeof(CollisionRect), rects.size(), out);
+    fwrite(words.data(), sizeof(uint64_t), words.size(), out);
+    fclose(out);
+
+    printf("%d rects, %dx%d mask at (%d, %d) -> %s\n", (int)rects.size(),
+           header.maskWidth, header.maskHeight, minX, minY, path);
+    return true;
+}
+
+static bool WriteHeader(const char *path, const Grid &grid, const std::vector<CollisionRect> &rects)
+{
+    FILE *out = fopen(path, "w");
+    if (out == nullptr)
+    {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return false;
+    }
+
+    fprintf(out, "// Generated by PC/tools/CollisionBaker from PC/assets/background_walk.png.\n");
+    fprintf(out, "// Do not edit; repaint the mask and re-run the baker.\n");
+    fprintf(out, "#ifndef WALK_MASK_H\n#define WALK_MASK_H\n\n#include <stdint.h>\n#include \"game_defs.h\"\n\n");
+
+    fprintf(out, "#define WALKABLE_FLOOR_COUNT %d\n", (int)rects.size());
+    fprintf(out, "Rect walkableFloors[WALKABLE_FLOOR_COUNT] = {");
+    for (size_t i = 0; i < rects.size(); i++)
+        fprintf(out, "%s{ %d, %d, %d, %d },", (i % 4 == 0) ? "\n    " : " ",
+                rects[i].x, rects[i].y, rects[i].w, rects[i].h);
+    fprintf(out, "\n};\n\n");
+
+    // Same layout as Player::walkMask: edges inclusive, so one extra row/column
+    const int rowWords = (ESP32_SCREEN_W + 32) / 32;
+    fprintf(out, "const uint32_t walkMaskBits[SCREEN_H + 1][(SCREEN_W + 32) / 32] = {\n");
+    for (int y = 0; y <= ESP32_SCREEN_H; y++)
+    {
+        fprintf(out, "    {");
+        for (int w = 0; w < rowWords; w++)
+        {
+            uint32_t bits = 0;
+            for (int b = 0; b < 32; b++)
+                if (grid.At(w * 32 + b, y))
+                    bits |= 1UL << b;
+            fprintf(out, "%s0x%08X", w ? ", " : "", (unsigned)bits);
+        }
+        fprintf(out, "},\n");
+    }
+    fprintf(out, "};\n\n#endif\n");
+    fclose(out);
+
+    printf("%d ESP32 rects -> %s\n", (int)rects.size(), path);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3 && !(argc == 5 && strcmp(argv[3], "--header") == 0))
+    {
+        printf("Usage: CollisionBaker <mask.png> <out.bin> [--header <out.h>]\n");
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    Image image = LoadImage(argv[1]);
+    if (image.data == nullptr)
+    {
+        fprintf(stderr, "Cannot read %s\n", argv[1]);
+        return 1;
+    }
+
+    Grid floor;
+    floor.width = image.width;
+    floor.height = image.height;
+    floor.cells.resize((size_t)image.width * image.height);
+
+    Color *pixels = LoadImageColors(image);
+    for (size_t i = 0; i < floor.cells.size(); i++)
+    {
+        Color c = pixels[i];
+        int luma = (c.r * 299 + c.g * 587 + c.b * 114) / 1000;
+        floor.cells[i] = (c.a >= 128 && luma >= 128) ? 1 : 0;
+    }
+    UnloadImageColors(pixels);
+    UnloadImage(image);
+
+    if (!WriteBin(argv[2], floor, CoverRects(floor)))
+        return 1;
+
+    if (argc == 5)
+    {
+        // Each ESP32 pixel takes the centre of its 5x5 block
+        Grid small;
+        small.width = ESP32_SCREEN_W + 1;
+        small.height = ESP32_SCREEN_H + 1;
+        small.cells.resize((size_t)small.width * small.height);
+        for (int y = 0; y < small.height; y++)
+            for (int x = 0; x < small.width; x++)
+                small.cells[(size_t)y * small.width + x] =
+                    floor.At(x * ESP32_SCALE + ESP32_SCALE / 2, y * ESP32_SCALE + ESP32_SCALE / 2);
+
+        if (!WriteHeader(argv[4], small, CoverRects(small)))
+            return 1;
+    }
+    return 0;
+}
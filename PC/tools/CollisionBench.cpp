@@ -0,0 +1,100 @@
+// Microbenchmark: walkable point queries, rect scan vs CollisionMask.
+//
+//   CollisionBench [queries]
+//
+// For growing zone counts, times the same random feet positions against the
+// old linear rect scan and the baked bit grid, and checks both agree.
+
+#include "../src/CollisionMask.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// What Player::CheckCollision did before the mask
+static bool ScanZones(const std::vector<Rect> &zones, int x, int y)
+{
+    for (const Rect &box : zones)
+    {
+        if (x >= box.x && x <= box.x + box.w &&
+            y >= box.y && y <= box.y + box.h)
+            return true;
+    }
+    return false;
+}
+
+// Small xorshift so every run uses the same points
+static unsigned int rngState = 2463534242u;
+static int Random(int range)
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return (int)(rngState % (unsigned int)range);
+}
+
+// Zones the size of the map's, scattered over the screen
+static std::vector<Rect> MakeZones(int count)
+{
+    std::vector<Rect> zones;
+    for (int i = 0; i < count; i++)
+    {
+        int w = 4 + Random(120);
+        int h = 4 + Random(40);
+        zones.push_back({Random(GAME_WIDTH - w), Random(GAME_HEIGHT - h), w, h});
+    }
+    return zones;
+}
+
+template <typename Query>
+static double NanosecondsPerQuery(const std::vector<int> &points, int *hits, Query query)
+{
+    auto start = std::chrono::steady_clock::now();
+    int count = 0;
+    for (size_t i = 0; i < points.size(); i += 2)
+        count += query(points[i], points[i + 1]) ? 1 : 0;
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    *hits = count;
+    return ns / (points.size() / 2);
+}
+
+int main(int argc, char **argv)
+{
+    int queries = (argc > 1) ? atoi(argv[1]) : 2000000;
+    if (queries <= 0)
+        queries = 2000000;
+
+    std::vector<int> points((size_t)queries * 2);
+    for (int i = 0; i < queries; i++)
+    {
+        points[i * 2] = Random(GAME_WIDTH);
+        points[i * 2 + 1] = Random(GAME_HEIGHT);
+    }
+
+    printf("%8s %12s %12s %12s %10s\n", "Zones", "Build us", "Scan ns", "Mask ns", "Speedup");
+
+    static const int zoneCounts[] = {7, 13, 100, 1000, 10000};
+    for (int zoneCount : zoneCounts)
+    {
+        std::vector<Rect> zones = MakeZones(zoneCount);
+
+        CollisionMask mask;
+        auto buildStart = std::chrono::steady_clock::now();
+        mask.Build(zones);
+        double buildUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - buildStart).count();
+
+        int scanHits = 0, maskHits = 0;
+        double scanNs = NanosecondsPerQuery(points, &scanHits, [&](int x, int y)
+                                            { return ScanZones(zones, x, y); });
+        double maskNs = NanosecondsPerQuery(points, &maskHits, [&](int x, int y)
+                                            { return mask.Test(x, y); });
+
+        if (scanHits != maskHits)
+        {
+            fprintf(stderr, "Mismatch at %d zones: scan %d hits, mask %d\n", zoneCount, scanHits, maskHits);
+            return 1;
+        }
+
+        printf("%8d %12.1f %12.2f %12.2f %9.1fx\n", zoneCount, buildUs, scanNs, maskNs, scanNs / maskNs);
+    }
+    return 0;
+}
@@ -0,0 +1,403 @@
+// Build step: compiles the dialogue script into the flat table the game reads.
+//
+//   DialogueCompiler <dialogue.script> <out.bin> [--header <out.h>]
+//
+// The syntax is described at the top of assets/dialogue.script, the output
+// format in src/DialogueFormat.h. --header also writes the same bytes as a C
+// array for the ESP32 sketch.
+
+#include "../src/DialogueFormat.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+// The tables are read in place on the ESP32, so the layout must not depend
+// on the compiler
+static_assert(sizeof(DialogueScriptHeader) == 20, "header layout");
+static_assert(sizeof(DialogueNode) == 44, "node layout");
+static_assert(sizeof(DialogueVariant) == 4 && sizeof(DialogueOption) == 8, "table layout");
+
+struct Line
+{
+    int number;
+    std::vector<std::string> words; // Quotes removed, escapes resolved
+};
+
+// Parsed node before next/option targets are resolved to indices
+struct NodeSource
+{
+    DialogueNode node;
+    int line;
+    std::string next;
+    std::vector<std::string> optionTargets;
+    std::vector<int> optionLines;
+};
+
+static const char *scriptPath = "";
+
+static void Fail(int line, const char *message, const std::string &detail = "")
+{
+    printf("%s:%d: %s%s%s\n", scriptPath, line, message, detail.empty() ? "" : ": ", detail.c_str());
+    exit(1);
+}
+
+// Splits on whitespace; "quoted strings" may hold spaces and \n \" \\ escapes
+static bool Tokenize(const std::string &text, std::vector<std::string> *words)
+{
+    size_t i = 0;
+    while (i < text.size())
+    {
+        if (text[i] == ' ' || text[i] == '\t' || text[i] == '\r')
+        {
+            i++;
+            continue;
+        }
+        if (text[i] == '#')
+            break;
+
+        std::string word;
+        if (text[i] == '"')
+        {
+            i++;
+            while (i < text.size() && text[i] != '"')
+            {
+                if (text[i] == '\\' && i + 1 < text.size())
+                {
+                    i++;
+                    word += (text[i] == 'n') ? '\n' : text[i];
+                }
+                else
+                {
+                    word += text[i];
+                }
+                i++;
+            }
+            if (i >= text.size())
+                return false;
+            i++;
+        }
+        else
+        {
+            while (i < text.size() && text[i] != ' ' && text[i] != '\t' && text[i] != '\r')
+                word += text[i++];
+        }
+        words->push_back(word);
+    }
+    return true;
+}
+
+static int ParseVar(const Line &line, const std::string &word)
+{
+    if (word == "choice")
+        return DVAR_CHOICE;
+    if (word == "story")
+        return DVAR_STORY;
+    if (word == "item")
+        return DVAR_ITEM;
+    Fail(line.number, "unknown variable", word);
+    return DVAR_NONE;
+}
+
+static int ParseInt(const Line &line, const std::string &word)
+{
+    char *end = nullptr;
+    long value = strtol(word.c_str(), &end, 10);
+    if (word.empty() || *end != '\0' || value < -32767 || value > 32767)
+        Fail(line.number, "expected a number", word);
+    return (int)value;
+}
+
+// --- STRING TABLE ---
+// Each string id has one entry per column; identical texts share bytes
+static std::vector<uint32_t> stringOffsets;
+static std::string textBlob;
+static std::map<std::string, uint32_t> textOffsets;
+
+static uint16_t AddString(const Line &line, size_t first)
+{
+    if (line.words.size() != first + DIALOGUE_COLUMNS)
+        Fail(line.number, "expected EN, CN and LCD text");
+
+    for (int c = 0; c < DIALOGUE_COLUMNS; c++)
+    {
+        const std::string &text = line.words[first + c];
+        auto found = textOffsets.find(text);
+        if (found == textOffsets.end())
+        {
+            found = textOffsets.emplace(text, (uint32_t)textBlob.size()).first;
+            textBlob += text;
+            textBlob += '\0';
+        }
+        stringOffsets.push_back(found->second);
+    }
+    return (uint16_t)(stringOffsets.size() / DIALOGUE_COLUMNS - 1);
+}
+
+static void WriteHeaderFile(const char *path, const std::vector<unsigned char> &bytes)
+{
+    FILE *out = fopen(path, "w");
+    if (out == nullptr)
+    {
+        printf("DialogueCompiler: cannot write %s\n", path);
+        exit(1);
+    }
+
+    fprintf(out, "// Generated by PC/tools/DialogueCompiler from PC/assets/dialogue.script.\n");
+    fprintf(out, "// Do not edit; change the script and re-run the compiler.\n");
+    fprintf(out, "#ifndef DIALOGUE_SCRIPT_H\n#define DIALOGUE_SCRIPT_H\n\n#include <stdint.h>\n\n");
+    fprintf(out, "const uint32_t dialogueScriptSize = %u;\n", (unsigned)bytes.size());
+    fprintf(out, "alignas(4) const uint8_t dialogueScript[] = {");
+    for (size_t i = 0; i < bytes.size(); i++)
+        fprintf(out, "%s0x%02X,", (i % 16 == 0) ? "\n    " : " ", bytes[i]);
+    fprintf(out, "\n};\n\n#endif\n");
+    fclose(out);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3 && !(argc == 5 && strcmp(argv[3], "--header") == 0))
+    {
+        printf("Usage: DialogueCompiler <dialogue.script> <out.bin> [--header <out.h>]\n");
+        return 1;
+    }
+    scriptPath = argv[1];
+
+    // 1. Read and tokenize
+    FILE *in = fopen(scriptPath, "rb");
+    if (in == nullptr)
+    {
+        printf("DialogueCompiler: cannot read %s\n", scriptPath);
+        return 1;
+    }
+
+    std::vector<Line> lines;
+    char buffer[1024];
+    int number = 0;
+    while (fgets(buffer, sizeof(buffer), in))
+    {
+        number++;
+        Line line = {number, {}};
+        std::string text = buffer;
+        if (!text.empty() && text.back() == '\n')
+            text.pop_back();
+        if (!Tokenize(text, &line.words))
+            Fail(number, "unterminated string");
+        if (!line.words.empty())
+            lines.push_back(line);
+    }
+    fclose(in);
+
+    // 2. Parse nodes
+    std::vector<NodeSource> nodes;
+    std::vector<DialogueVariant> variants;
+    std::vector<DialogueOption> options;
+
+    for (const Line &line : lines)
+    {
+        const std::string &key = line.words[0];
+        size_t count = line.words.size();
+
+        if (key == "node")
+        {
+            if (count != 3)
+                Fail(line.number, "expected: node NAME line|choice|items|event");
+            if (line.words[1].size() >= DIALOGUE_NAME_LEN)
+                Fail(line.number, "node name too long", line.words[1]);
+            for (const NodeSource &other : nodes)
+            {
+                if (line.words[1] == other.node.name)
+                    Fail(line.number, "duplicate node", line.words[1]);
+            }
+
+            NodeSource source = {};
+            source.line = line.number;
+            strcpy(source.node.name, line.words[1].c_str());
+
+            const std::string &type = line.words[2];
+            if (type == "line")
+                source.node.type = DNODE_LINE;
+            else if (type == "choice")
+                source.node.type = DNODE_CHOICE;
+            else if (type == "items")
+                source.node.type = DNODE_ITEMS;
+            else if (type == "event")
+                source.node.type = DNODE_EVENT;
+            else
+                Fail(line.number, "unknown node type", type);
+
+            source.node.firstVariant = (uint8_t)variants.size();
+            source.node.firstOption = (uint8_t)options.size();
+            source.node.speed = -1;
+            source.node.waitMs = 300;
+            source.node.next = DIALOGUE_EXIT;
+            nodes.push_back(source);
+            continue;
+        }
+
+        if (nodes.empty())
+            Fail(line.number, "expected a node first");
+        NodeSource &source = nodes.back();
+        DialogueNode &node = source.node;
+
+        if (key == "text")
+        {
+            DialogueVariant variant = {DIALOGUE_ANY, 0};
+            size_t first = 1;
+            if (count == 2 + DIALOGUE_COLUMNS)
+            {
+                variant.match = (int16_t)ParseInt(line, line.words[1]);
+                first = 2;
+            }
+            variant.text = AddString(line, first);
+            variants.push_back(variant);
+            node.variantCount++;
+        }
+        else if (key == "var" && count == 2)
+        {
+            node.var = (uint8_t)ParseVar(line, line.words[1]);
+        }
+        else if (key == "speed" && count == 2)
+        {
+            node.speed = (int16_t)ParseInt(line, line.words[1]);
+        }
+        else if (key == "wait" && count == 2)
+        {
+            node.waitMs = (uint16_t)(atof(line.words[1].c_str()) * 1000.0 + 0.5);
+        }
+        else if (key == "on" && (count == 5 || count == 6))
+        {
+            if (line.words[1] == "enter")
+                node.actionWhen = DWHEN_ENTER;
+            else if (line.words[1] == "next")
+                node.actionWhen = DWHEN_NEXT;
+            else
+                Fail(line.number, "expected on enter|next", line.words[1]);
+
+            if (line.words[2] == "set")
+                node.actionOp = DOP_SET;
+            else if (line.words[2] == "add")
+                node.actionOp = DOP_ADD;
+            else
+                Fail(line.number, "expected set|add", line.words[2]);
+
+            node.actionVar = (uint8_t)ParseVar(line, line.words[3]);
+            node.actionValue = (int16_t)ParseInt(line, line.words[4]);
+            node.actionMax = (int16_t)((count == 6) ? ParseInt(line, line.words[5]) : 32767);
+        }
+        else if (key == "next" && count == 2)
+        {
+            source.next = line.words[1];
+        }
+        else if (key == "option" && node.type == DNODE_CHOICE && count >= 3)
+        {
+            DialogueOption option = {};
+            option.x = (int16_t)ParseInt(line, line.words[1]);
+            option.text = AddString(line, 3);
+            options.push_back(option);
+            source.optionTargets.push_back(line.words[2]);
+            source.optionLines.push_back(line.number);
+            node.optionCount++;
+        }
+        else if (key == "item" && node.type == DNODE_ITEMS && count >= 3)
+        {
+            DialogueOption option = {};
+            if (line.words[1] == "coffee")
+                option.item = DITEM_COFFEE;
+            else if (line.words[1] == "gas")
+                option.item = DITEM_GAS;
+            else if (line.words[1] == "battery")
+                option.item = DITEM_BATTERY;
+            else
+                Fail(line.number, "unknown item", line.words[1]);
+            option.text = AddString(line, 3);
+            options.push_back(option);
+            source.optionTargets.push_back(line.words[2]);
+            source.optionLines.push_back(line.number);
+            node.optionCount++;
+        }
+        else if (key == "event" && node.type == DNODE_EVENT && count == 2)
+        {
+            if (line.words[1] == "coffee")
+                node.event = DEVENT_COFFEE;
+            else
+                Fail(line.number, "unknown event", line.words[1]);
+        }
+        else
+        {
+            Fail(line.number, "unexpected", key);
+        }
+
+        if (variants.size() > 255 || options.size() > 255)
+            Fail(line.number, "too many texts or options");
+    }
+
+    // 3. Resolve names to node indices
+    auto resolve = [&](const std::string &name, int line) -> int16_t
+    {
+        if (name.empty() || name == "@map")
+            return DIALOGUE_EXIT;
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            if (name == nodes[i].node.name)
+                return (int16_t)i;
+        }
+        Fail(line, "unknown node", name);
+        return DIALOGUE_EXIT;
+    };
+
+    for (NodeSource &source : nodes)
+    {
+        DialogueNode &node = source.node;
+        node.next = resolve(source.next, source.line);
+        for (int i = 0; i < node.optionCount; i++)
+            options[node.firstOption + i].next = resolve(source.optionTargets[i], source.optionLines[i]);
+
+        if (node.type != DNODE_EVENT && node.type != DNODE_LINE && node.optionCount == 0)
+            Fail(source.line, "node has no options", node.name);
+        if (node.type == DNODE_LINE && node.variantCount == 0)
+            Fail(source.line, "node has no text", node.name);
+    }
+
+    // 4. Write
+    DialogueScriptHeader header = {};
+    header.magic = DIALOGUE_MAGIC;
+    header.version = DIALOGUE_VERSION;
+    header.nodeCount = (uint16_t)nodes.size();
+    header.variantCount = (uint16_t)variants.size();
+    header.optionCount = (uint16_t)options.size();
+    header.stringCount = (uint16_t)(stringOffsets.size() / DIALOGUE_COLUMNS);
+    header.textBytes = (uint32_t)textBlob.size();
+
+    std::vector<unsigned char> bytes;
+    auto append = [&](const void *data, size_t size)
+    {
+        const unsigned char *p = (const unsigned char *)data;
+        bytes.insert(bytes.end(), p, p + size);
+    };
+    append(&header, sizeof(header));
+    for (const NodeSource &source : nodes)
+        append(&source.node, sizeof(DialogueNode));
+    append(variants.data(), variants.size() * sizeof(DialogueVariant));
+    append(options.data(), options.size() * sizeof(DialogueOption));
+    append(stringOffsets.data(), stringOffsets.size() * sizeof(uint32_t));
+    append(textBlob.data(), textBlob.size());
+
+    FILE *out = fopen(argv[2], "wb");
+    if (out == nullptr)
+    {
+        printf("DialogueCompiler: cannot write %s\n", argv[2]);
+        return 1;
+    }
+    fwrite(bytes.data(), 1, bytes.size(), out);
+    fclose(out);
+
+    if (argc == 5)
+        WriteHeaderFile(argv[4], bytes);
+
+    printf("DialogueCompiler: %d nodes, %d strings, %d bytes -> %s\n",
+           header.nodeCount, header.stringCount, (int)bytes.size(), argv[2]);
+    return 0;
+}
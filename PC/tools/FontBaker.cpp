@@ -0,0 +1,122 @@
+// Build step: bakes the Chinese font into a single .atlas asset.
+//
+//   FontBaker <font.ttf> <out.atlas> <size> <input files...>
+//
+// Every distinct codepoint in the inputs (the CN dialogue text, the string
+// catalog and the game sources) is rasterized once and packed into one
+// atlas. Printable ASCII is always included.
+
+#include "raylib.h"
+#include "../src/BakedFont.h"
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+int main(int argc, char **argv)
+{
+    if (argc < 5)
+    {
+        printf("Usage: FontBaker <font.ttf> <out.atlas> <size> <input files...>\n");
+        return 1;
+    }
+
+    const char *fontPath = argv[1];
+    const char *outPath = argv[2];
+    int fontSize = atoi(argv[3]);
+    const int padding = 4;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // 1. Collect unique codepoints
+    std::set<int> unique;
+    for (int c = 32; c < 127; c++)
+        unique.insert(c);
+
+    for (int i = 4; i < argc; i++)
+    {
+        char *text = LoadFileText(argv[i]);
+        if (text == nullptr)
+        {
+            printf("FontBaker: cannot read %s\n", argv[i]);
+            return 1;
+        }
+
+        int n = 0;
+        int *cps = LoadCodepoints(text, &n);
+        for (int k = 0; k < n; k++)
+        {
+            // ASCII is already in; skip control characters and bad bytes ('?')
+            if (cps[k] >= 128)
+                unique.insert(cps[k]);
+        }
+        UnloadCodepoints(cps);
+        UnloadFileText(text);
+    }
+
+    std::vector<int> codepoints(unique.begin(), unique.end());
+
+    // 2. Rasterize and pack
+    int fileSize = 0;
+    unsigned char *fontData = LoadFileData(fontPath, &fileSize);
+    if (fontData == nullptr)
+    {
+        printf("FontBaker: cannot read %s\n", fontPath);
+        return 1;
+    }
+
+    int glyphCount = (int)codepoints.size();
+    GlyphInfo *glyphs = LoadFontData(fontData, fileSize, fontSize, codepoints.data(), glyphCount, FONT_DEFAULT);
+    UnloadFileData(fontData);
+    if (glyphs == nullptr)
+    {
+        printf("FontBaker: rasterization failed\n");
+        return 1;
+    }
+
+    Rectangle *recs = nullptr;
+    Image atlas = GenImageFontAtlas(glyphs, &recs, glyphCount, fontSize, padding, 1); // 1 = skyline packing
+
+    // 3. Write header, glyph table, pixels
+    BakedFontHeader header = {};
+    header.magic = BAKED_FONT_MAGIC;
+    header.version = BAKED_FONT_VERSION;
+    header.baseSize = fontSize;
+    header.glyphPadding = padding;
+    header.glyphCount = glyphCount;
+    header.atlasWidth = atlas.width;
+    header.atlasHeight = atlas.height;
+    header.atlasFormat = atlas.format;
+    header.pixelBytes = (uint32_t)(atlas.width * atlas.height * 2); // GenImageFontAtlas outputs GRAY_ALPHA
+
+    FILE *out = fopen(outPath, "wb");
+    if (out == nullptr)
+    {
+        printf("FontBaker: cannot write %s\n", outPath);
+        return 1;
+    }
+
+    fwrite(&header, sizeof(header), 1, out);
+    for (int i = 0; i < glyphCount; i++)
+    {
+        BakedGlyph g = {};
+        g.codepoint = glyphs[i].value;
+        g.offsetX = glyphs[i].offsetX;
+        g.offsetY = glyphs[i].offsetY;
+        g.advanceX = glyphs[i].advanceX;
+        g.recX = recs[i].x;
+        g.recY = recs[i].y;
+        g.recWidth = recs[i].width;
+        g.recHeight = recs[i].height;
+        fwrite(&g, sizeof(g), 1, out);
+    }
+    fwrite(atlas.data, 1, header.pixelBytes, out);
+    fclose(out);
+
+    printf("FontBaker: %d glyphs, %dx%d atlas -> %s\n", glyphCount, atlas.width, atlas.height, outPath);
+
+    UnloadImage(atlas);
+    MemFree(recs);
+    UnloadFontData(glyphs, glyphCount);
+    return 0;
+}
@@ -0,0 +1,456 @@
+// Build step: compiles the string catalog into the table the game maps.
+//
+//   StringCompiler <strings.catalog> <out.bin> [--ids <StringIds.h>]
+//                  [--measure en|cn <font file>]... [--header <out.h>]
+//
+// The syntax is described at the top of assets/strings.catalog, the output
+// format in src/StringFormat.h. --ids writes the STR_ enum the game is
+// compiled against. --measure pre-measures a column's strings with the font
+// the game draws it with, loaded the way Fonts.cpp loads it; unmeasured
+// columns are measured at runtime. --header writes the enum and the same
+// bytes as a C array for the ESP32 sketch.
+
+#include "raylib.h"
+#include "../src/StringFormat.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// The tables are read in place, so the layout must not depend on the
+// compiler
+static_assert(sizeof(StringTableHeader) == 20, "header layout");
+static_assert(sizeof(StringColumn) == 8 && sizeof(StringEntry) == 16, "table layout");
+
+// Fonts.cpp loads both fonts at this size
+#define MEASURE_BASE_SIZE 64
+
+struct CatalogString
+{
+    std::string name;
+    std::string text[STRING_COLUMNS];
+};
+
+static const char *catalogPath = "";
+
+static void Fail(int line, const char *message, const std::string &detail = "")
+{
+    printf("%s:%d: %s%s%s\n", catalogPath, line, message, detail.empty() ? "" : ": ", detail.c_str());
+    exit(1);
+}
+
+// Splits on whitespace; "quoted strings" may hold spaces and \n \" \\ escapes.
+// Same rules as tools/DialogueCompiler.cpp.
+static bool Tokenize(const std::string &text, std::vector<std::string> *words)
+{
+    size_t i = 0;
+    while (i < text.size())
+    {
+        if (text[i] == ' ' || text[i] == '\t' || text[i] == '\r')
+        {
+            i++;
+            continue;
+        }
+        if (text[i] == '#')
+            break;
+
+        std::string word;
+        if (text[i] == '"')
+        {
+            i++;
+            while (i < text.size() && text[i] != '"')
+            {
+                if (text[i] == '\\' && i + 1 < text.size())
+                {
+                    i++;
+                    word += (text[i] == 'n') ? '\n' : text[i];
+                }
+                else
+                {
+                    word += text[i];
+                }
+                i++;
+            }
+            if (i >= text.size())
+                return false;
+            i++;
+        }
+        else
+        {
+            while (i < text.size() && text[i] != ' ' && text[i] != '\t' && text[i] != '\r')
+                word += text[i++];
+        }
+        words->push_back(word);
+    }
+    return true;
+}
+
+static bool IsIdName(const std::string &name)
+{
+    if (name.empty() || (name[0] >= '0' && name[0] <= '9'))
+        return false;
+    for (char c : name)
+    {
+        if (!((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_'))
+            return false;
+    }
+    return true;
+}
+
+// FNV-1a over the names in id order, so a table and a build that disagree on
+// the ids are caught at load time
+static uint32_t HashIds(const std::vector<CatalogString> &strings)
+{
+    uint32_t hash = 2166136261u;
+    for (const CatalogString &s : strings)
+    {
+        for (size_t i = 0; i <= s.name.size(); i++) // Terminator included
+        {
+            hash ^= (unsigned char)s.name.c_str()[i];
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+}
+
+// --- MEASURING ---
+// Glyph metrics for one column, as the game's font has them
+struct MeasureFont
+{
+    GlyphInfo *glyphs = nullptr;
+    Rectangle *recs = nullptr;
+    int glyphCount = 0;
+};
+
+static bool LoadMeasureFont(const char *path, int column, const std::vector<CatalogString> &strings, MeasureFont *out)
+{
+    int size = 0;
+    unsigned char *data = LoadFileData(path, &size);
+    if (data == nullptr)
+        return false;
+
+    // fontEN is ASCII only (raylib's default set); fontCN has whatever the
+    // text uses, like the baked atlas
+    std::vector<int> codepoints;
+    if (column == STRING_COL_CN)
+    {
+        std::set<int> unique;
+        for (int c = 32; c < 127; c++)
+            unique.insert(c);
+        for (const CatalogString &s : strings)
+        {
+            const std::string &text = s.text[column];
+            for (size_t i = 0; i < text.size();)
+            {
+                int bytes = 0;
+                int codepoint = GetCodepointNext(&text[i], &bytes);
+                if (codepoint >= 128)
+                    unique.insert(codepoint);
+                i += bytes;
+            }
+        }
+        codepoints.assign(unique.begin(), unique.end());
+    }
+
+    out->glyphCount = codepoints.empty() ? 95 : (int)codepoints.size();
+    out->glyphs = LoadFontData(data, size, MEASURE_BASE_SIZE, codepoints.empty() ? NULL : codepoints.data(),
+                               (int)codepoints.size(), FONT_DEFAULT);
+    UnloadFileData(data);
+    if (out->glyphs == nullptr)
+        return false;
+
+    // Only for glyphs without an advance, as MeasureTextEx() does
+    Image atlas = GenImageFontAtlas(out->glyphs, &out->recs, out->glyphCount, MEASURE_BASE_SIZE, 4, 0);
+    UnloadImage(atlas);
+    return true;
+}
+
+// GetGlyphIndex(): the glyph, else '?', else the first one
+static int FindGlyph(const MeasureFont &font, int codepoint)
+{
+    int fallback = 0;
+    for (int i = 0; i < font.glyphCount; i++)
+    {
+        if (font.glyphs[i].value == codepoint)
+            return i;
+        if (font.glyphs[i].value == '?')
+            fallback = i;
+    }
+    return fallback;
+}
+
+// MeasureTextEx() at the base size with no spacing, plus the counts that
+// make it exact at any size and spacing
+static void MeasureEntry(const MeasureFont *font, const std::string &text, StringEntry *entry)
+{
+    float lineWidth = 0.0f, maxLineWidth = 0.0f;
+    int lineCount = 0, maxLineCount = 0;
+    int codepoints = 0, lines = 1;
+
+    for (size_t i = 0; i < text.size();)
+    {
+        int bytes = 0;
+        int codepoint = GetCodepointNext(&text[i], &bytes);
+        i += bytes;
+        codepoints++;
+        lineCount++;
+
+        if (codepoint == '\n')
+        {
+            if (maxLineWidth < lineWidth)
+                maxLineWidth = lineWidth;
+            lineWidth = 0.0f;
+            lineCount = 0;
+            lines++;
+        }
+        else if (font != nullptr)
+        {
+            int index = FindGlyph(*font, codepoint);
+            if (font->glyphs[index].advanceX != 0)
+                lineWidth += (float)font->glyphs[index].advanceX;
+            else
+                lineWidth += font->recs[index].width + (float)font->glyphs[index].offsetX;
+        }
+        if (maxLineCount < lineCount)
+            maxLineCount = lineCount;
+    }
+    if (maxLineWidth < lineWidth)
+        maxLineWidth = lineWidth;
+
+    entry->width = maxLineWidth;
+    entry->codepoints = (uint16_t)codepoints;
+    entry->spacingCount = (uint16_t)((maxLineCount > 0) ? maxLineCount - 1 : 0);
+    entry->lines = (uint16_t)lines;
+}
+
+// --- OUTPUT ---
+
+static FILE *OpenOutput(const char *path)
+{
+    FILE *out = fopen(path, "w");
+    if (out == nullptr)
+    {
+        printf("StringCompiler: cannot write %s\n", path);
+        exit(1);
+    }
+    return out;
+}
+
+static void WriteIdEnum(FILE *out, const std::vector<CatalogString> &strings, uint32_t hash)
+{
+    fprintf(out, "#include <stdint.h>\n\n");
+    fprintf(out, "#define STRING_IDS_HASH 0x%08Xu\n\n", hash);
+    fprintf(out, "enum StringId : uint16_t\n{\n");
+    for (size_t i = 0; i < strings.size(); i++)
+        fprintf(out, "    STR_%s,\n", strings[i].name.c_str());
+    fprintf(out, "    STRING_COUNT\n};\n");
+}
+
+static void WriteIdsFile(const char *path, const std::vector<CatalogString> &strings, uint32_t hash)
+{
+    FILE *out = OpenOutput(path);
+    fprintf(out, "// Generated by tools/StringCompiler from assets/strings.catalog.\n");
+    fprintf(out, "// Do not edit; change the catalog and rebuild.\n");
+    fprintf(out, "#ifndef STRING_IDS_H\n#define STRING_IDS_H\n\n");
+    WriteIdEnum(out, strings, hash);
+    fprintf(out, "\n#endif\n");
+    fclose(out);
+}
+
+static void WriteHeaderFile(const char *path, const std::vector<CatalogString> &strings, uint32_t hash,
+                            const std::vector<unsigned char> &bytes)
+{
+    FILE *out = OpenOutput(path);
+    fprintf(out, "// Generated by PC/tools/StringCompiler from PC/assets/strings.catalog.\n");
+    fprintf(out, "// Do not edit; change the catalog and re-run the compiler.\n");
+    fprintf(out, "#ifndef STRING_CATALOG_H\n#define STRING_CATALOG_H\n\n");
+    WriteIdEnum(out, strings, hash);
+    fprintf(out, "\nconst uint32_t stringCatalogSize = %u;\n", (unsigned)bytes.size());
+    fprintf(out, "alignas(4) const uint8_t stringCatalog[] = {");
+    for (size_t i = 0; i < bytes.size(); i++)
+        fprintf(out, "%s0x%02X,", (i % 16 == 0) ? "\n    " : " ", bytes[i]);
+    fprintf(out, "\n};\n\n#endif\n");
+    fclose(out);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        printf("Usage: StringCompiler <strings.catalog> <out.bin> [--ids <StringIds.h>] "
+               "[--measure en|cn <font file>]... [--header <out.h>]\n");
+        return 1;
+    }
+    catalogPath = argv[1];
+    const char *outPath = argv[2];
+    const char *idsPath = nullptr;
+    const char *headerPath = nullptr;
+    const char *fontPaths[STRING_COLUMNS] = {};
+
+    for (int i = 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--ids") == 0 && i + 1 < argc)
+            idsPath = argv[++i];
+        else if (strcmp(argv[i], "--header") == 0 && i + 1 < argc)
+            headerPath = argv[++i];
+        else if (strcmp(argv[i], "--measure") == 0 && i + 2 < argc &&
+                 (strcmp(argv[i + 1], "en") == 0 || strcmp(argv[i + 1], "cn") == 0))
+        {
+            int column = (strcmp(argv[i + 1], "cn") == 0) ? STRING_COL_CN : STRING_COL_EN;
+            fontPaths[column] = argv[i + 2];
+            i += 2;
+        }
+        else
+        {
+            printf("StringCompiler: unexpected argument %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    // 1. Read and parse
+    FILE *in = fopen(catalogPath, "rb");
+    if (in == nullptr)
+    {
+        printf("StringCompiler: cannot read %s\n", catalogPath);
+        return 1;
+    }
+
+    std::vector<CatalogString> strings;
+    strings.push_back({"NONE", {}});
+
+    char buffer[1024];
+    int number = 0;
+    while (fgets(buffer, sizeof(buffer), in))
+    {
+        number++;
+        std::string text = buffer;
+        if (!text.empty() && text.back() == '\n')
+            text.pop_back();
+
+        std::vector<std::string> words;
+        if (!Tokenize(text, &words))
+            Fail(number, "unterminated string");
+        if (words.empty())
+            continue;
+
+        // LCD may be left out
+        if (words[0] != "string" || words.size() < 4 || words.size() > 2 + STRING_COLUMNS)
+            Fail(number, "expected: string NAME \"EN\" \"CN\" [\"LCD\"]");
+        if (!IsIdName(words[1]))
+            Fail(number, "names are A-Z, 0-9 and _", words[1]);
+        for (const CatalogString &other : strings)
+        {
+            if (words[1] == other.name)
+                Fail(number, "duplicate string", words[1]);
+        }
+
+        CatalogString s;
+        s.name = words[1];
+        for (size_t c = 0; c + 2 < words.size(); c++)
+            s.text[c] = words[c + 2];
+        strings.push_back(s);
+    }
+    fclose(in);
+
+    if (strings.size() > 65535)
+        Fail(number, "too many strings");
+
+    // 2. Measure
+    MeasureFont fonts[STRING_COLUMNS];
+    bool measured[STRING_COLUMNS] = {};
+    for (int c = 0; c < STRING_COLUMNS; c++)
+    {
+        if (fontPaths[c] == nullptr)
+            continue;
+        if (!LoadMeasureFont(fontPaths[c], c, strings, &fonts[c]))
+        {
+            printf("StringCompiler: cannot load font %s\n", fontPaths[c]);
+            return 1;
+        }
+        measured[c] = true;
+    }
+
+    // 3. Lay out the tables. Identical texts share bytes.
+    std::string textBlob;
+    std::map<std::string, uint32_t> textOffsets;
+    std::vector<StringEntry> entries;
+    for (int c = 0; c < STRING_COLUMNS; c++)
+    {
+        for (const CatalogString &s : strings)
+        {
+            const std::string &text = s.text[c];
+            auto found = textOffsets.find(text);
+            if (found == textOffsets.end())
+            {
+                found = textOffsets.emplace(text, (uint32_t)textBlob.size()).first;
+                textBlob += text;
+                textBlob += '\0';
+            }
+
+            StringEntry entry = {};
+            entry.offset = found->second;
+            MeasureEntry(measured[c] ? &fonts[c] : nullptr, text, &entry);
+            entries.push_back(entry);
+        }
+    }
+    while (textBlob.size() % 4 != 0)
+        textBlob += '\0';
+
+    for (int c = 0; c < STRING_COLUMNS; c++)
+    {
+        if (measured[c])
+        {
+            UnloadFontData(fonts[c].glyphs, fonts[c].glyphCount);
+            MemFree(fonts[c].recs);
+        }
+    }
+
+    // 4. Write
+    uint32_t hash = HashIds(strings);
+
+    StringTableHeader header = {};
+    header.magic = STRINGS_MAGIC;
+    header.version = STRINGS_VERSION;
+    header.stringCount = (uint16_t)strings.size();
+    header.columnCount = STRING_COLUMNS;
+    header.textBytes = (uint32_t)textBlob.size();
+    header.idHash = hash;
+
+    StringColumn columns[STRING_COLUMNS] = {};
+    for (int c = 0; c < STRING_COLUMNS; c++)
+        columns[c].baseSize = measured[c] ? (float)MEASURE_BASE_SIZE : 0.0f;
+
+    std::vector<unsigned char> bytes;
+    auto append = [&](const void *data, size_t size)
+    {
+        const unsigned char *p = (const unsigned char *)data;
+        bytes.insert(bytes.end(), p, p + size);
+    };
+    append(&header, sizeof(header));
+    append(columns, sizeof(columns));
+    append(entries.data(), entries.size() * sizeof(StringEntry));
+    append(textBlob.data(), textBlob.size());
+
+    FILE *out = fopen(outPath, "wb");
+    if (out == nullptr)
+    {
+        printf("StringCompiler: cannot write %s\n", outPath);
+        return 1;
+    }
+    fwrite(bytes.data(), 1, bytes.size(), out);
+    fclose(out);
+
+    if (idsPath != nullptr)
+        WriteIdsFile(idsPath, strings, hash);
+    if (headerPath != nullptr)
+        WriteHeaderFile(headerPath, strings, hash, bytes);
+
+    printf("StringCompiler: %d strings, %d bytes%s%s -> %s\n", (int)strings.size(), (int)bytes.size(),
+           measured[STRING_COL_EN] ? ", EN measured" : "", measured[STRING_COL_CN] ? ", CN measured" : "", outPath);
+    return 0;
+}